@@ -0,0 +1,117 @@
+"""Send links to a running editor over the Hyperlink IPC server.
+
+Links are read from the arguments, or one per line from stdin if there are none, and sent in batches. Each link is
+framed as its UTF-8 length as a little endian uint32 followed by the link, and a zero length frame ends a batch. The
+editor replies with one status byte per link once the batch has been queued.
+
+Examples:
+    python unreal_hyperlink_cli.py --project-dir D:/MyProject --project MyProject "http://localhost:10416/..."
+    python unreal_hyperlink_cli.py --endpoint /path/to/MyProject/Saved/Hyperlink/links.sock < links.txt
+"""
+
+import argparse
+import os
+import socket
+import struct
+import sys
+
+# Values of EHyperlinkIpcStatus, which are fixed by the protocol
+STATUSES = {
+    0: 'queued',
+    1: 'malformed',
+    2: 'not stored',
+    3: 'unknown definition',
+    4: 'missing asset',
+    5: 'dropped',
+    6: 'unavailable',
+    7: 'coalesced',
+}
+
+
+def get_endpoint(project_dir: str, project: str) -> str:
+    """Endpoint the editor listens on, see FHyperlinkIpcServer::GetEndpointName."""
+    if sys.platform == 'win32':
+        return '\\\\.\\pipe\\UnrealHyperlink-' + project
+    return os.path.join(os.path.abspath(project_dir), 'Saved', 'Hyperlink', 'links.sock')
+
+
+class Connection:
+    def __init__(self, endpoint: str):
+        if sys.platform == 'win32':
+            self._pipe = open(endpoint, 'r+b', buffering=0)
+            self._socket = None
+        else:
+            self._pipe = None
+            self._socket = socket.socket(socket.AF_UNIX, socket.SOCK_STREAM)
+            self._socket.connect(endpoint)
+
+    def send(self, data: bytes):
+        if self._socket:
+            self._socket.sendall(data)
+        else:
+            self._pipe.write(data)
+
+    def receive(self, num_bytes: int) -> bytes:
+        data = bytearray()
+        while len(data) < num_bytes:
+            chunk = self._socket.recv(num_bytes - len(data)) if self._socket else self._pipe.read(num_bytes - len(data))
+            if not chunk:
+                raise ConnectionError('The editor closed the connection')
+            data += chunk
+        return bytes(data)
+
+    def close(self):
+        if self._socket:
+            self._socket.close()
+        else:
+            self._pipe.close()
+
+
+def send_batch(connection: Connection, links: list) -> bytes:
+    frames = bytearray()
+    for link in links:
+        encoded = link.encode('utf-8')
+        frames += struct.pack('<I', len(encoded)) + encoded
+    frames += struct.pack('<I', 0)
+    connection.send(bytes(frames))
+    return connection.receive(len(links))
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description='Send links to a running editor over the Hyperlink IPC server.')
+    parser.add_argument('links', nargs='*', help='Links to send, read one per line from stdin if none are given')
+    parser.add_argument('--endpoint', help='Socket path or pipe name, logged by the editor on startup')
+    parser.add_argument('--project-dir', default='.', help='Project directory, used to find the socket')
+    parser.add_argument('--project', help='Project identifier from the Hyperlink settings, used to find the pipe')
+    # The editor queues at most 256 links at once, larger batches are queued over several frames
+    parser.add_argument('--batch-size', type=int, default=256, help='Links sent per batch')
+    args = parser.parse_args()
+
+    if args.endpoint:
+        endpoint = args.endpoint
+    elif sys.platform == 'win32' and not args.project:
+        parser.error('--project or --endpoint is required on Windows')
+    else:
+        endpoint = get_endpoint(args.project_dir, args.project)
+
+    links = args.links or [line.strip() for line in sys.stdin if line.strip()]
+
+    num_failed = 0
+    connection = Connection(endpoint)
+    try:
+        for start in range(0, len(links), args.batch_size):
+            batch = links[start:start + args.batch_size]
+            for link, status in zip(batch, send_batch(connection, batch)):
+                if status != 0:
+                    num_failed += 1
+                    name = STATUSES.get(status, str(status))
+                    print(f'{name}: {link}', file=sys.stderr)
+    finally:
+        connection.close()
+
+    print(f'Queued {len(links) - num_failed} of {len(links)} links')
+    return 1 if num_failed else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
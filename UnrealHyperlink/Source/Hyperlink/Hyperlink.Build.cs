@@ -14,6 +14,7 @@ public class Hyperlink : ModuleRules
                 "Core", 
                 "DeveloperSettings",
                 "Json",
+                "JsonUtilities",
                 "Engine",
             }
         );
@@ -23,7 +24,6 @@ public class Hyperlink : ModuleRules
             {
                 "CoreUObject",
                 "Engine",
-                "JsonUtilities",
                 "Slate",
                 "SlateCore",
             }
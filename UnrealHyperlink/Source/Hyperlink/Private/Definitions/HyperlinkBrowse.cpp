@@ -3,8 +3,6 @@
 
 #include "Definitions/HyperlinkBrowse.h"
 
-#include "HyperlinkCommonPayload.h"
-#include "JsonObjectConverter.h"
 #if WITH_EDITOR
 #include "AssetRegistry/IAssetRegistry.h"
 #include "ContentBrowserModule.h"
@@ -28,6 +26,7 @@ void FHyperlinkBrowseCommands::RegisterCommands()
 {
 	UI_COMMAND(CopyBrowseLink, "Copy Browse Link", "Copy a link to browse to the selected asset", EUserInterfaceActionType::Button, FInputChord(EModifierKey::Alt | EModifierKey::Shift, EKeys::C));
 	UI_COMMAND(CopyFolderLink, "Copy Browse Link", "Copy a link to browse to the selected folder", EUserInterfaceActionType::Button, FInputChord(EModifierKey::Alt | EModifierKey::Shift, EKeys::C));
+	UI_COMMAND(CopyBrowseLinks, "Copy Browse Links for Selection", "Copy a link to browse to each of the selected assets and folders", EUserInterfaceActionType::Button, FInputChord());
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -43,6 +42,10 @@ void UHyperlinkBrowse::Initialize()
 	BrowseCommands->MapAction(
 		FHyperlinkBrowseCommands::Get().CopyFolderLink,
 		FExecuteAction::CreateUObject(this, &UHyperlinkDefinition::CopyLink));
+
+	BrowseCommands->MapAction(
+		FHyperlinkBrowseCommands::Get().CopyBrowseLinks,
+		FExecuteAction::CreateUObject(this, &UHyperlinkDefinition::CopyLinks));
 	
 	// Context menu extensions
 	FHyperlinkUtility::AddHyperlinkSubMenuAndEntry(TEXT("ContentBrowser.AssetContextMenu"), TEXT("CommonAssetActions"),
@@ -50,6 +53,11 @@ void UHyperlinkBrowse::Initialize()
 
 	FHyperlinkUtility::AddHyperlinkSubMenuAndEntry(TEXT("ContentBrowser.FolderContextMenu"), TEXT("PathViewFolderOptions"),
 	                                               BrowseCommands, FHyperlinkBrowseCommands::Get().CopyFolderLink);
+
+	FHyperlinkUtility::AddHyperlinkMenuEntry(TEXT("ContentBrowser.AssetContextMenu"), BrowseCommands,
+	                                         FHyperlinkBrowseCommands::Get().CopyBrowseLinks);
+	FHyperlinkUtility::AddHyperlinkMenuEntry(TEXT("ContentBrowser.FolderContextMenu"), BrowseCommands,
+	                                         FHyperlinkBrowseCommands::Get().CopyBrowseLinks);
 	
 	// Keyboard shortcut command
 	// Note that the keyboard shortcut will only be registered if applied on startup because of the way content
@@ -76,92 +84,102 @@ void UHyperlinkBrowse::Deinitialize()
 	
 	FHyperlinkBrowseCommands::Unregister();
 }
+
+bool UHyperlinkBrowse::GetDeferredInitializeMenus(TArray<FName>& OutMenuNames) const
+{
+	OutMenuNames.Emplace(TEXT("ContentBrowser.AssetContextMenu"));
+	OutMenuNames.Emplace(TEXT("ContentBrowser.FolderContextMenu"));
+	return true;
+}
 #endif //WITH_EDITOR
 
-TSharedPtr<FJsonObject> UHyperlinkBrowse::GeneratePayload(const TArray<FString>& Args) const
+bool UHyperlinkBrowse::GenerateTypedPayload(const TArray<FString>& Args, FHyperlinkNamePayload& OutPayload) const
 {
-	TSharedPtr<FJsonObject> Payload{ nullptr };
+	// The first selected asset, otherwise the first selected folder or the current path
+	TArray<FHyperlinkNamePayload> Payloads{};
+	const bool bResult{ GenerateTypedPayloads(Args, Payloads) };
+	if (bResult)
+	{
+		OutPayload = Payloads[0];
+	}
+	return bResult;
+}
+
+bool UHyperlinkBrowse::GenerateTypedPayloads(const TArray<FString>& Args,
+	TArray<FHyperlinkNamePayload>& OutPayloads) const
+{
+	const int32 NumPayloads{ OutPayloads.Num() };
 
 #if WITH_EDITOR
 	const FContentBrowserModule& ContentBrowser =
 		FModuleManager::LoadModuleChecked<FContentBrowserModule>(TEXT("ContentBrowser"));
 	TArray<FAssetData> SelectedAssets{};
 	ContentBrowser.Get().GetSelectedAssets(SelectedAssets);
+	TArray<FString> SelectedFolders{};
+	ContentBrowser.Get().GetSelectedFolders(SelectedFolders);
 
-	if (SelectedAssets.Num() > 0 )
+	OutPayloads.Reserve(NumPayloads + SelectedAssets.Num() + SelectedFolders.Num());
+	for (const FAssetData& Asset : SelectedAssets)
 	{
-		Payload = GeneratePayloadFromPath(SelectedAssets[0].PackageName);
+		OutPayloads.Emplace(FHyperlinkNamePayload{ Asset.PackageName });
 	}
-	else
+
+	if (SelectedFolders.Num() > 0)
 	{
-		TArray<FString> SelectedFolders{};
-		ContentBrowser.Get().GetSelectedFolders(SelectedFolders);
-		if (SelectedFolders.Num() > 0)
+		UContentBrowserDataSubsystem* const ContentBrowserData{ GEditor->GetEditorSubsystem<UContentBrowserDataSubsystem>() };
+		for (const FString& VirtualPath : SelectedFolders)
 		{
 			// The path will be an "virtual path" which is usually (always?) the internal path prefixed with "/All"
 			// We need to convert this to the regular internal path
-			const FString& VirtualPath{ SelectedFolders[0] };
 			FString InternalPath;
-			const EContentBrowserPathType ConvertedType{ GEditor->GetEditorSubsystem<UContentBrowserDataSubsystem>()->
-			                                                      TryConvertVirtualPath(VirtualPath, InternalPath) };
+			const EContentBrowserPathType ConvertedType{ ContentBrowserData->TryConvertVirtualPath(VirtualPath, InternalPath) };
 			
 			if (ConvertedType == EContentBrowserPathType::Internal)
 			{
-				Payload = GeneratePayloadFromPath(FName(InternalPath));
+				OutPayloads.Emplace(FHyperlinkNamePayload{ FName(InternalPath) });
 			}
 			else
 			{
 				UE_LOG(LogHyperlink, Error, TEXT("Failed to convert %s to an internal path, cannot create browse link."), *VirtualPath);
 			}
 		}
+	}
+	else if (SelectedAssets.Num() == 0)
+	{
+		// Make folder link with current path
+		const FContentBrowserItemPath CurrentPath{ ContentBrowser.Get().GetCurrentPath() };
+		if (CurrentPath.HasInternalPath())
+		{
+			OutPayloads.Emplace(FHyperlinkNamePayload{ CurrentPath.GetInternalPathName() });
+		}
 		else
 		{
-			// Make folder link with current path
-			const FContentBrowserItemPath CurrentPath{ ContentBrowser.Get().GetCurrentPath() };
-			if (CurrentPath.HasInternalPath())
-			{
-				Payload = GeneratePayloadFromPath(CurrentPath.GetInternalPathName());
-			}
-			else
-			{
-				UE_LOG(LogHyperlink, Error, TEXT("Cannot create browse link at invalid path."));
-			}
+			UE_LOG(LogHyperlink, Error, TEXT("Cannot create browse link at invalid path."));
 		}
 	}
 #endif //WITH_EDITOR
 
-
-	return Payload;
-}
-
-TSharedPtr<FJsonObject> UHyperlinkBrowse::GeneratePayloadFromPath(const FName& PackageOrFolderName) const
-{
-	const FHyperlinkNamePayload PayloadStruct{ PackageOrFolderName };
-	return FJsonObjectConverter::UStructToJsonObject(PayloadStruct);
+	return OutPayloads.Num() > NumPayloads;
 }
 
 #if WITH_EDITOR
-void UHyperlinkBrowse::ExecutePayload(const TSharedRef<FJsonObject>& InPayload)
+void UHyperlinkBrowse::ExecuteTypedPayload(const FHyperlinkNamePayload& InPayload)
 {
-	FHyperlinkNamePayload PayloadStruct{};
-	if (FJsonObjectConverter::JsonObjectToUStruct(InPayload, &PayloadStruct))
-	{
-		TArray<FAssetData> LinkAssetData{};
-		IAssetRegistry::Get()->GetAssetsByPackageName(PayloadStruct.Name, LinkAssetData);
+	TArray<FAssetData> LinkAssetData{};
+	IAssetRegistry::Get()->GetAssetsByPackageName(InPayload.Name, LinkAssetData);
 
-		const FContentBrowserModule& ContentBrowserModule =
-			FModuleManager::LoadModuleChecked<FContentBrowserModule>(TEXT("ContentBrowser"));
-		
-		if (LinkAssetData.Num() > 0)
-		{
-			// Treat as asset
-			ContentBrowserModule.Get().SyncBrowserToAssets(LinkAssetData);
-		}
-		else
-		{
-			// Treat as folder
-			ContentBrowserModule.Get().SyncBrowserToFolders({ PayloadStruct.Name.ToString() });
-		}
+	const FContentBrowserModule& ContentBrowserModule =
+		FModuleManager::LoadModuleChecked<FContentBrowserModule>(TEXT("ContentBrowser"));
+	
+	if (LinkAssetData.Num() > 0)
+	{
+		// Treat as asset
+		ContentBrowserModule.Get().SyncBrowserToAssets(LinkAssetData);
+	}
+	else
+	{
+		// Treat as folder
+		ContentBrowserModule.Get().SyncBrowserToFolders({ InPayload.Name.ToString() });
 	}
 }
 #endif //WITH_EDITOR
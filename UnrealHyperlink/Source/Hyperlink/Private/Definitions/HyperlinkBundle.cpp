@@ -0,0 +1,171 @@
+// Copyright (c) 2023-2024 Fergus Brown. Licensed under the MIT license. See "LICENSE" file for details.
+
+
+#include "Definitions/HyperlinkBundle.h"
+
+#include "Engine/Engine.h"
+#include "HyperlinkSubsystem.h"
+#include "LogHyperlink.h"
+#if WITH_EDITOR
+#include "Definitions/HyperlinkEdit.h"
+#include "Editor.h"
+#include "Engine/World.h"
+#include "HyperlinkCommonPayload.h"
+#include "HyperlinkExecutePayload.h"
+#include "HyperlinkUtility.h"
+#include "Subsystems/AssetEditorSubsystem.h"
+
+#define LOCTEXT_NAMESPACE "HyperlinkBundle"
+
+FHyperlinkBundleCommands::FHyperlinkBundleCommands()
+	: TCommands<FHyperlinkBundleCommands>(
+		TEXT("HyperlinkBundle"),
+		NSLOCTEXT("Contexts", "HyperlinkBundle", "Hyperlink Bundle"),
+		NAME_None,
+		FAppStyle::GetAppStyleSetName())
+{
+}
+
+void FHyperlinkBundleCommands::RegisterCommands()
+{
+	UI_COMMAND(CopyWorkspaceLink, "Copy Workspace Link", "Copy a link to restore the open level, selected actors, viewport and asset editors",
+	           EUserInterfaceActionType::Button, FInputChord());
+}
+
+#undef LOCTEXT_NAMESPACE
+
+void UHyperlinkBundle::Initialize()
+{
+	// Check for editor in case launching game with editor build
+	if (GIsEditor)
+	{
+		FHyperlinkBundleCommands::Register();
+		BundleCommands = MakeShared<FUICommandList>();
+		BundleCommands->MapAction(
+			FHyperlinkBundleCommands::Get().CopyWorkspaceLink,
+			FExecuteAction::CreateUObject(this, &UHyperlinkDefinition::CopyLink));
+
+		FHyperlinkUtility::AddHyperlinkSubMenuAndEntry(TEXT("LevelEditor.LevelViewportToolBar.Options"),
+			TEXT("LevelViewportViewportOptions"), BundleCommands, FHyperlinkBundleCommands::Get().CopyWorkspaceLink);
+	}
+}
+
+void UHyperlinkBundle::Deinitialize()
+{
+	FHyperlinkBundleCommands::Unregister();
+}
+
+bool UHyperlinkBundle::GetDeferredInitializeMenus(TArray<FName>& OutMenuNames) const
+{
+	OutMenuNames.Emplace(TEXT("LevelEditor.LevelViewportToolBar.Options"));
+	return true;
+}
+#endif //WITH_EDITOR
+
+bool UHyperlinkBundle::GenerateTypedPayload(const TArray<FString>& Args, FHyperlinkBundlePayload& OutPayload) const
+{
+	if (Args.Num() > 0)
+	{
+		for (const FString& Identifier : Args)
+		{
+			AddDefinitionEntries(Identifier, OutPayload);
+		}
+	}
+	else
+	{
+		for (const FString& Identifier : WorkspaceIdentifiers)
+		{
+			AddDefinitionEntries(Identifier, OutPayload);
+		}
+#if WITH_EDITOR
+		AddAssetEditorEntries(OutPayload);
+#endif //WITH_EDITOR
+	}
+
+	const bool bResult{ OutPayload.Entries.Num() > 0 };
+	UE_CLOG(!bResult, LogHyperlink, Display, TEXT("Cannot generate Bundle link, no links were generated"));
+	
+	return bResult;
+}
+
+bool UHyperlinkBundle::AddDefinitionEntries(const FString& Identifier, FHyperlinkBundlePayload& OutPayload) const
+{
+	bool bResult{ false };
+	
+	UHyperlinkSubsystem* const Subsystem{ GEngine->GetEngineSubsystem<UHyperlinkSubsystem>() };
+	const UHyperlinkDefinition* const Definition{ Subsystem ? Subsystem->LoadDefinition(Identifier) : nullptr };
+	if (!Definition)
+	{
+		UE_LOG(LogHyperlink, Warning, TEXT("Cannot add %s links to bundle: no registered definition with this identifier"),
+			*Identifier);
+	}
+	else if (Definition == this)
+	{
+		UE_LOG(LogHyperlink, Warning, TEXT("Cannot add a bundle to a bundle"));
+	}
+	else
+	{
+		TArray<FString> PayloadStrings{};
+		bResult = Definition->GeneratePayloadStrings({}, PayloadStrings);
+		if (bResult)
+		{
+			OutPayload.Entries.Reserve(OutPayload.Entries.Num() + PayloadStrings.Num());
+			for (FString& PayloadString : PayloadStrings)
+			{
+				OutPayload.Entries.Emplace(FHyperlinkBundleEntry{ Identifier, MoveTemp(PayloadString) });
+			}
+		}
+	}
+	
+	return bResult;
+}
+
+#if WITH_EDITOR
+bool UHyperlinkBundle::AddAssetEditorEntries(FHyperlinkBundlePayload& OutPayload)
+{
+	bool bResult{ false };
+	
+	const UHyperlinkSubsystem* const Subsystem{ GEngine->GetEngineSubsystem<UHyperlinkSubsystem>() };
+	const FString EditIdentifier{ Subsystem ? Subsystem->FindIdentifier(UHyperlinkEdit::StaticClass()) : FString() };
+	if (!EditIdentifier.IsEmpty() && GEditor)
+	{
+		for (const UObject* const Asset : GEditor->GetEditorSubsystem<UAssetEditorSubsystem>()->GetAllEditedAssets())
+		{
+			// The level is restored by the level's own links
+			if (Asset && !Asset->IsA<UWorld>())
+			{
+				FString PayloadString{};
+				if (THyperlinkPayloadCodec<FHyperlinkNamePayload>::Write(
+					FHyperlinkNamePayload{ Asset->GetPackage()->GetFName() }, PayloadString))
+				{
+					OutPayload.Entries.Emplace(FHyperlinkBundleEntry{ EditIdentifier, MoveTemp(PayloadString) });
+					bResult = true;
+				}
+			}
+		}
+	}
+	
+	return bResult;
+}
+
+void UHyperlinkBundle::ExecuteTypedPayload(const FHyperlinkBundlePayload& InPayload)
+{
+	UHyperlinkSubsystem* const Subsystem{ GEngine->GetEngineSubsystem<UHyperlinkSubsystem>() };
+	if (Subsystem->IsExecutingBundle())
+	{
+		UE_LOG(LogHyperlink, Warning, TEXT("Cannot execute a bundle from within a bundle"));
+	}
+	else
+	{
+		TArray<FHyperlinkExecutePayload> Payloads{};
+		Payloads.Reserve(InPayload.Entries.Num());
+		for (const FHyperlinkBundleEntry& Entry : InPayload.Entries)
+		{
+			FHyperlinkExecutePayload& Payload{ Payloads.AddDefaulted_GetRef() };
+			Payload.Identifier = Entry.Identifier;
+			Payload.DefinitionPayload.JsonString = Entry.Payload;
+		}
+		Subsystem->ExecuteBundle(MoveTemp(Payloads));
+	}
+}
+#endif //WITH_EDITOR
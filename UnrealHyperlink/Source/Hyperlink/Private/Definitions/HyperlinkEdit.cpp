@@ -3,7 +3,6 @@
 
 #include "Definitions/HyperlinkEdit.h"
 
-#include "HyperlinkCommonPayload.h"
 #include "JsonObjectConverter.h"
 #if WITH_EDITOR
 #include "ContentBrowserModule.h"
@@ -11,6 +10,18 @@
 #include "IContentBrowserSingleton.h"
 #include "LogHyperlink.h"
 
+namespace FHyperlinkEditHelpers
+{
+	static TArray<FAssetData> GetSelectedContentBrowserAssets()
+	{
+		const FContentBrowserModule& ContentBrowser
+			{ FModuleManager::LoadModuleChecked<FContentBrowserModule>(TEXT("ContentBrowser")) };
+		TArray<FAssetData> SelectedAssets{};
+		ContentBrowser.Get().GetSelectedAssets(SelectedAssets);
+		return SelectedAssets;
+	}
+}
+
 #define LOCTEXT_NAMESPACE "HyperlinkEdit"
 
 FHyperlinkEditCommands::FHyperlinkEditCommands()
@@ -28,6 +39,8 @@ void FHyperlinkEditCommands::RegisterCommands()
 	           EUserInterfaceActionType::Button, FInputChord(EModifierKey::Alt | EModifierKey::Shift, EKeys::E));
 	UI_COMMAND(CopyAssetEditorLink, "Copy Edit Link", "Copy a link to edit this asset",
 	           EUserInterfaceActionType::Button, FInputChord(EModifierKey::Alt | EModifierKey::Shift, EKeys::E));
+	UI_COMMAND(CopyContentBrowserLinks, "Copy Edit Links for Selection", "Copy a link to edit each of the selected assets",
+	           EUserInterfaceActionType::Button, FInputChord());
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -40,13 +53,19 @@ void UHyperlinkEdit::Initialize()
 		FHyperlinkEditCommands::Get().CopyContentBrowserLink,
 		FExecuteAction::CreateUObject(this, &UHyperlinkDefinition::CopyLink)
 	);
+	EditCommands->MapAction(
+		FHyperlinkEditCommands::Get().CopyContentBrowserLinks,
+		FExecuteAction::CreateUObject(this, &UHyperlinkDefinition::CopyLinks)
+	);
 	EditCommands->MapAction(
 		FHyperlinkEditCommands::Get().CopyAssetEditorLink,
 		FExecuteAction::CreateWeakLambda(this, [this]()
 		{
-			if(const TSharedPtr<FJsonObject> Payload{ GeneratePayloadFromAssetEditor() })
+			FString PayloadString{};
+			if (THyperlinkPayloadCodec<FHyperlinkNamePayload>::Write(
+				FHyperlinkNamePayload{ AssetEditorPackageName }, PayloadString))
 			{
-				CopyLink(Payload.ToSharedRef());
+				CopyLinkFromPayloadString(PayloadString);
 			}
 		})
 	);
@@ -54,6 +73,8 @@ void UHyperlinkEdit::Initialize()
 	// Content Browser asset context menu
 	FHyperlinkUtility::AddHyperlinkSubMenuAndEntry(TEXT("ContentBrowser.AssetContextMenu"), TEXT("CommonAssetActions"),
 	                                               EditCommands, FHyperlinkEditCommands::Get().CopyContentBrowserLink);
+	FHyperlinkUtility::AddHyperlinkMenuEntry(TEXT("ContentBrowser.AssetContextMenu"), EditCommands,
+	                                         FHyperlinkEditCommands::Get().CopyContentBrowserLinks);
 	
 	// Asset Editor asset menu
 	// Note because of the way asset editor drop down menus work we can't (easily) add this entry in a sub menu
@@ -76,8 +97,21 @@ void UHyperlinkEdit::Initialize()
 	
 	FContentBrowserModule& ContentBrowser{ FModuleManager::LoadModuleChecked<FContentBrowserModule>(TEXT("ContentBrowser")) };
 	ContentBrowser.GetAllContentBrowserCommandExtenders().Emplace(MoveTemp(CommandExtender));
+}
 
-	// Asset editor extension delegate for recording edited asset
+void UHyperlinkEdit::Deinitialize()
+{
+	FContentBrowserModule& ContentBrowser{ FModuleManager::LoadModuleChecked<FContentBrowserModule>(TEXT("ContentBrowser")) };
+	ContentBrowser.GetAllContentBrowserCommandExtenders().RemoveAll(
+		[this](const FContentBrowserCommandExtender& Delegate){ return Delegate.GetHandle() == KeyboardShortcutHandle; });
+	
+	FHyperlinkEditCommands::Unregister();
+}
+
+void UHyperlinkEdit::PreInitialize()
+{
+	// Asset editor extension delegate for recording edited asset. Registered even while Initialize is deferred so asset
+	// editors opened before the menus are first used still record their package
 	TArray<FAssetEditorExtender>& AssetEditorMenuExtenderDelegates
 		{ FAssetEditorToolkit::GetSharedMenuExtensibilityManager()->GetExtenderDelegates() };
 	FAssetEditorExtender AssetEditorExtender{ FAssetEditorExtender::CreateUObject(this, &UHyperlinkEdit::OnExtendAssetEditor) };
@@ -85,54 +119,86 @@ void UHyperlinkEdit::Initialize()
 	AssetEditorMenuExtenderDelegates.Emplace(MoveTemp(AssetEditorExtender));
 }
 
-void UHyperlinkEdit::Deinitialize()
+void UHyperlinkEdit::PostDeinitialize()
 {
 	TArray<FAssetEditorExtender>& AssetEditorMenuExtenderDelegates
 		{ FAssetEditorToolkit::GetSharedMenuExtensibilityManager()->GetExtenderDelegates() };
 	AssetEditorMenuExtenderDelegates.RemoveAll(
 		[this](const FAssetEditorExtender& Delegate){ return Delegate.GetHandle() == AssetEditorExtensionHandle; });
-	
-	FContentBrowserModule& ContentBrowser{ FModuleManager::LoadModuleChecked<FContentBrowserModule>(TEXT("ContentBrowser")) };
-	ContentBrowser.GetAllContentBrowserCommandExtenders().RemoveAll(
-		[this](const FContentBrowserCommandExtender& Delegate){ return Delegate.GetHandle() == KeyboardShortcutHandle; });
-	
-	FHyperlinkEditCommands::Unregister();
+}
+
+bool UHyperlinkEdit::GetDeferredInitializeMenus(TArray<FName>& OutMenuNames) const
+{
+	OutMenuNames.Emplace(TEXT("ContentBrowser.AssetContextMenu"));
+	OutMenuNames.Emplace(TEXT("MainFrame.MainMenu.Asset"));
+	return true;
 }
 #endif //WITH_EDITOR
 
-TSharedPtr<FJsonObject> UHyperlinkEdit::GeneratePayload(const TArray<FString>& Args) const
+bool UHyperlinkEdit::GenerateTypedPayload(const TArray<FString>& Args, FHyperlinkNamePayload& OutPayload) const
 {
 #if WITH_EDITOR
-  	return GeneratePayloadFromContentBrowser();
+  	return GeneratePayloadFromContentBrowser(OutPayload);
 #else
-	return nullptr;
+	return false;
 #endif //WITH_EDITOR
 }
 
-TSharedPtr<FJsonObject> UHyperlinkEdit::GeneratePayloadFromPackageName(const FName& PackageName)
+bool UHyperlinkEdit::GenerateTypedPayloads(const TArray<FString>& Args,
+	TArray<FHyperlinkNamePayload>& OutPayloads) const
+{
+	bool bResult{ false };
+	
+#if WITH_EDITOR
+	const TArray<FAssetData> SelectedAssets{ FHyperlinkEditHelpers::GetSelectedContentBrowserAssets() };
+	OutPayloads.Reserve(OutPayloads.Num() + SelectedAssets.Num());
+	for (const FAssetData& Asset : SelectedAssets)
+	{
+		OutPayloads.Emplace(FHyperlinkNamePayload{ Asset.PackageName });
+	}
+	bResult = SelectedAssets.Num() > 0;
+	
+	UE_CLOG(!bResult, LogHyperlink, Display, TEXT("Cannot generate Edit links with no assets selected in Content Browser"));
+#endif //WITH_EDITOR
+	
+	return bResult;
+}
+
+/*static*/TSharedPtr<FJsonObject> UHyperlinkEdit::GeneratePayloadFromPackageName(const FName& PackageName)
 {
 	const FHyperlinkNamePayload PayloadStruct{ PackageName };
 	return FJsonObjectConverter::UStructToJsonObject(PayloadStruct);
 }
 
 #if WITH_EDITOR
-TSharedPtr<FJsonObject> UHyperlinkEdit::GeneratePayloadFromContentBrowser()
+bool UHyperlinkEdit::GeneratePayloadFromContentBrowser(FHyperlinkNamePayload& OutPayload)
 {
-	TSharedPtr<FJsonObject> Payload{ nullptr };
-	
-	const FContentBrowserModule& ContentBrowser{ FModuleManager::LoadModuleChecked<FContentBrowserModule>(TEXT("ContentBrowser")) };
-	TArray<FAssetData> SelectedAssets{};
-	ContentBrowser.Get().GetSelectedAssets(SelectedAssets);
+	bool bResult{ false };
 	
+	const TArray<FAssetData> SelectedAssets{ FHyperlinkEditHelpers::GetSelectedContentBrowserAssets() };
 	if (SelectedAssets.Num() > 0)
 	{
-		Payload = GeneratePayloadFromPackageName(SelectedAssets[0].PackageName);
+		OutPayload.Name = SelectedAssets[0].PackageName;
+		bResult = true;
 	}
 	else
 	{
 		UE_LOG(LogHyperlink, Display, TEXT("Cannot generate Edit link with no assets selected in Content Browser"));
 	}
 	
+	return bResult;
+}
+
+TSharedPtr<FJsonObject> UHyperlinkEdit::GeneratePayloadFromContentBrowser()
+{
+	TSharedPtr<FJsonObject> Payload{ nullptr };
+	
+	FHyperlinkNamePayload PayloadStruct{};
+	if (GeneratePayloadFromContentBrowser(PayloadStruct))
+	{
+		Payload = GeneratePayloadFromPackageName(PayloadStruct.Name);
+	}
+	
 	return Payload;
 }
 
@@ -141,13 +207,15 @@ TSharedPtr<FJsonObject> UHyperlinkEdit::GeneratePayloadFromAssetEditor() const
 	return GeneratePayloadFromPackageName(AssetEditorPackageName);
 }
 
-void UHyperlinkEdit::ExecutePayload(const TSharedRef<FJsonObject>& InPayload)
+void UHyperlinkEdit::ExecuteTypedPayload(const FHyperlinkNamePayload& InPayload)
 {
-	FHyperlinkNamePayload PayloadStruct{};
-	if (FJsonObjectConverter::JsonObjectToUStruct(InPayload, &PayloadStruct))
-	{
-		FHyperlinkUtility::OpenEditorForAsset(PayloadStruct.Name);
-	}
+	FHyperlinkUtility::OpenEditorForAssetAsync(InPayload.Name);
+}
+
+void UHyperlinkEdit::GetTypedPayloadDependencies(const FHyperlinkNamePayload& InPayload,
+	TArray<FName>& OutPackageNames) const
+{
+	OutPackageNames.Emplace(InPayload.Name);
 }
 
 // NOLINTNEXTLINE (performance-unnecessary-value-param) Delegate signature
@@ -4,8 +4,8 @@
 #include "Definitions/HyperlinkViewport.h"
 
 #include "GameFramework/PlayerController.h"
+#include "HyperlinkStats.h"
 #include "HyperlinkUtility.h"
-#include "JsonObjectConverter.h"
 #include "LogHyperlink.h"
 #if WITH_EDITOR
 #include "LevelEditor.h"
@@ -69,13 +69,21 @@ void UHyperlinkViewport::Deinitialize()
 #endif //WITH_EDITOR
 }
 
-TSharedPtr<FJsonObject> UHyperlinkViewport::GeneratePayload(const TArray<FString>& Args) const
+#if WITH_EDITOR
+bool UHyperlinkViewport::GetDeferredInitializeMenus(TArray<FName>& OutMenuNames) const
 {
-	TSharedPtr<FJsonObject> Payload{ nullptr };
-	
-	FName LevelPackageName{};
-	FVector Location{};
-	FRotator Rotation{};
+	OutMenuNames.Emplace(TEXT("LevelEditor.ActorContextMenu"));
+	OutMenuNames.Emplace(TEXT("LevelEditor.LevelEditorSceneOutliner.ContextMenu"));
+	OutMenuNames.Emplace(TEXT("LevelEditor.LevelViewportToolBar.Options"));
+	return true;
+}
+#endif //WITH_EDITOR
+
+bool UHyperlinkViewport::GenerateTypedPayload(const TArray<FString>& Args, FHyperlinkViewportPayload& OutPayload) const
+{
+	FName& LevelPackageName{ OutPayload.LevelPackageName };
+	FVector& Location{ OutPayload.Location };
+	FRotator& Rotation{ OutPayload.Rotation };
 	bool bCameraInfoFound{ false };
 	
 #if WITH_EDITOR
@@ -105,29 +113,12 @@ TSharedPtr<FJsonObject> UHyperlinkViewport::GeneratePayload(const TArray<FString
 		bCameraInfoFound = GetGameWorldCameraInfo(GetWorld(), Location, Rotation);
 	}
 	
-	if (bCameraInfoFound)
-	{
-		Payload = GeneratePayload(LevelPackageName, Location, Rotation);
-	}
-	else
+	if (!bCameraInfoFound)
 	{
 		UE_LOG(LogHyperlink, Display, TEXT("Failed to generate Viewport link: could not find viewport camera info."));
-
 	}
 	
-	return Payload;
-}
-
-TSharedPtr<FJsonObject> UHyperlinkViewport::GeneratePayload(const FName& InLevelPackageName,
-	const FVector& InLocation, const FRotator& InRotation) const
-{
-	const FHyperlinkViewportPayload PayloadStruct
-	{
-		InLevelPackageName,
-		InLocation,
-		InRotation
-	};
-	return FJsonObjectConverter::UStructToJsonObject(PayloadStruct);
+	return bCameraInfoFound;
 }
 
 /*static*/bool UHyperlinkViewport::GetGameWorldCameraInfo(const UWorld* const World, FVector& OutLocation, FRotator& OutRotation)
@@ -147,39 +138,45 @@ TSharedPtr<FJsonObject> UHyperlinkViewport::GeneratePayload(const FName& InLevel
 }
 
 #if WITH_EDITOR
-void UHyperlinkViewport::ExecutePayload(const TSharedRef<FJsonObject>& InPayload)
+void UHyperlinkViewport::ExecuteTypedPayload(const FHyperlinkViewportPayload& InPayload)
 {
-	FHyperlinkViewportPayload PayloadStruct{};
+	HYPERLINK_SCOPE_CYCLE_COUNTER(STAT_HyperlinkMoveViewport);
+	
+	const FName& LevelPackageName{ InPayload.LevelPackageName };
+	const FVector& Location{ InPayload.Location };
+	const FRotator& Rotation{ InPayload.Rotation };
 
-	if (FJsonObjectConverter::JsonObjectToUStruct(InPayload, &PayloadStruct))
+	// Attempt to teleport pawn in PIE
+	if (const FWorldContext* const PieWorldContext{ GEditor->GetPIEWorldContext() })
 	{
-		const FName& LevelPackageName{ PayloadStruct.LevelPackageName };
-		const FVector& Location{ PayloadStruct.Location };
-		const FRotator& Rotation{ PayloadStruct.Rotation };
-	
-		// Attempt to teleport pawn in PIE
-		if (const FWorldContext* const PieWorldContext{ GEditor->GetPIEWorldContext() })
+		if (const UWorld* const PieWorld{ PieWorldContext->World() })
 		{
-			if (const UWorld* const PieWorld{ PieWorldContext->World() })
+			const FName EditorWorldPackageName{ GEditor->EditorWorld->PersistentLevel->GetPackage()->GetFName() };
+			if (EditorWorldPackageName == LevelPackageName)
 			{
-				const FName EditorWorldPackageName{ GEditor->EditorWorld->PersistentLevel->GetPackage()->GetFName() };
-				if (EditorWorldPackageName == LevelPackageName)
+				if (APawn* const Pawn{ PieWorld->GetFirstPlayerController()->GetPawn() })
 				{
-					if (APawn* const Pawn{ PieWorld->GetFirstPlayerController()->GetPawn() })
-					{
-						Pawn->TeleportTo(Location, Rotation);
-						return;
-					}
+					Pawn->TeleportTo(Location, Rotation);
+					return;
 				}
 			}
 		}
-	
-		// If PIE teleport fails open the level and move viewport to location
-		if(FHyperlinkUtility::OpenEditorForAsset(LevelPackageName))
+	}
+
+	// If PIE teleport fails open the level and move viewport to location
+	FHyperlinkUtility::OpenEditorForAssetAsync(LevelPackageName, [Location, Rotation](const UObject* const Level)
+	{
+		if (Level)
 		{
 			UUnrealEditorSubsystem* const UnrealEditorSubsystem{ GEditor->GetEditorSubsystem<UUnrealEditorSubsystem>() };
 			UnrealEditorSubsystem->SetLevelViewportCameraInfo(Location, Rotation);
 		}
-	}
+	});
+}
+
+void UHyperlinkViewport::GetTypedPayloadDependencies(const FHyperlinkViewportPayload& InPayload,
+	TArray<FName>& OutPackageNames) const
+{
+	OutPackageNames.Emplace(InPayload.LevelPackageName);
 }
 #endif //WITH_EDITOR
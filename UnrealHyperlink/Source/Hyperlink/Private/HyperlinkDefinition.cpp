@@ -5,58 +5,118 @@
 
 #include "HyperlinkUtility.h"
 #include "LogHyperlink.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Serialization/JsonSerializer.h"
 #include "Windows/WindowsPlatformApplicationMisc.h"
 #if WITH_EDITOR
 #include "Framework/Notifications/NotificationManager.h"
 #include "Widgets/Notifications/SNotificationList.h"
 #endif //WITH_EDITOR
 
-void UHyperlinkDefinition::CopyLink() const
+namespace FHyperlinkDefinitionHelpers
 {
-	CopyLink(TArray<FString>());
-}
-
-void UHyperlinkDefinition::CopyLink(const TArray<FString>& Args) const
-{
-	// Editor only code used to display notification
+	static void NotifyCopy(const bool bSuccess, const FText& Text)
+	{
 #if WITH_EDITOR
-	FNotificationInfo Info{ FText::GetEmpty() };
-	Info.ExpireDuration = 2.0f;
-	Info.bUseSuccessFailIcons = true;
-	SNotificationItem::ECompletionState CompletionState{ SNotificationItem::CS_None };
+		FNotificationInfo Info{ Text };
+		Info.ExpireDuration = 2.0f;
+		Info.bUseSuccessFailIcons = true;
+		FSlateNotificationManager::Get().AddNotification(Info)->SetCompletionState(
+			bSuccess ? SNotificationItem::CS_Success : SNotificationItem::CS_Fail);
 #endif //WITH_EDITOR
+	}
+}
 
+bool UHyperlinkDefinition::GeneratePayloadString(const TArray<FString>& Args, FString& OutPayloadString) const
+{
+	bool bResult{ false };
 	if (const TSharedPtr<FJsonObject> Payload{ GeneratePayload(Args) })
 	{
-		CopyLink(Payload.ToSharedRef());
-		
+		const TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> JsonWriter
+			{ TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&OutPayloadString) };
+		bResult = FJsonSerializer::Serialize(Payload.ToSharedRef(), JsonWriter);
+	}
+	return bResult;
+}
+
+bool UHyperlinkDefinition::GeneratePayloadStrings(const TArray<FString>& Args,
+	TArray<FString>& OutPayloadStrings) const
+{
+	FString PayloadString{};
+	const bool bResult{ GeneratePayloadString(Args, PayloadString) };
+	if (bResult)
+	{
+		OutPayloadStrings.Emplace(MoveTemp(PayloadString));
+	}
+	return bResult;
+}
+
 #if WITH_EDITOR
-		Info.Text = FText::FromString(TEXT("Link Copied"));
-		CompletionState = SNotificationItem::CS_Success;
+bool UHyperlinkDefinition::ExecutePayloadString(const FStringView InPayloadString)
+{
+	bool bResult{ false };
+	TSharedPtr<FJsonObject> Payload{};
+	if (FJsonSerializer::Deserialize(TJsonReaderFactory<TCHAR>::CreateFromView(InPayloadString), Payload)
+		&& Payload.IsValid())
+	{
+		ExecutePayload(Payload.ToSharedRef());
+		bResult = true;
+	}
+	return bResult;
+}
 #endif //WITH_EDITOR
+
+void UHyperlinkDefinition::CopyLink() const
+{
+	CopyLink(TArray<FString>());
+}
+
+void UHyperlinkDefinition::CopyLink(const TArray<FString>& Args) const
+{
+	if (FString PayloadString{}; GeneratePayloadString(Args, PayloadString))
+	{
+		CopyLinkFromPayloadString(PayloadString);
+		FHyperlinkDefinitionHelpers::NotifyCopy(true, FText::FromString(TEXT("Link Copied")));
 	}
 	else
 	{
 		UE_LOG(LogHyperlink, Error, TEXT("Failed to generate and copy %s link"),
 			*GetClass()->GetDefaultObjectName().ToString());
-		
-#if WITH_EDITOR
-		Info.Text = FText::FromString(TEXT("Link Copy Failed"));
-		CompletionState = SNotificationItem::CS_Fail;
-#endif //WITH_EDITOR
+		FHyperlinkDefinitionHelpers::NotifyCopy(false, FText::FromString(TEXT("Link Copy Failed")));
 	}
+}
 
-#if WITH_EDITOR
-	FSlateNotificationManager::Get().AddNotification(Info)->SetCompletionState(CompletionState);
-#endif //WITH_EDITOR
+void UHyperlinkDefinition::CopyLinks() const
+{
+	CopyLinks(TArray<FString>());
+}
+
+void UHyperlinkDefinition::CopyLinks(const TArray<FString>& Args) const
+{
+	if (TArray<FString> PayloadStrings{}; GeneratePayloadStrings(Args, PayloadStrings) && PayloadStrings.Num() > 0)
+	{
+		const TArray<FString> Links{ FHyperlinkUtility::CreateLinksFromPayloads(GetClass(), PayloadStrings) };
+		const FString LinksString{ FString::Join(Links, TEXT("\n")) };
+		FPlatformApplicationMisc::ClipboardCopy(*LinksString);
+		
+		UE_LOG(LogHyperlink, Display, TEXT("Copied %d links"), Links.Num());
+		FHyperlinkDefinitionHelpers::NotifyCopy(true, FText::FromString(
+			FString::Printf(TEXT("%d Links Copied"), Links.Num())));
+	}
+	else
+	{
+		UE_LOG(LogHyperlink, Error, TEXT("Failed to generate and copy %s links"),
+			*GetClass()->GetDefaultObjectName().ToString());
+		FHyperlinkDefinitionHelpers::NotifyCopy(false, FText::FromString(TEXT("Link Copy Failed")));
+	}
 }
 
 void UHyperlinkDefinition::PrintLink(const TArray<FString>& Args) const
 {
-	if (const TSharedPtr<FJsonObject> Payload{ GeneratePayload(Args) })
+	if (FString PayloadString{}; GeneratePayloadString(Args, PayloadString))
 	{
 		UE_LOG(LogHyperlink, Display, TEXT("%s"),
-			*FHyperlinkUtility::CreateLinkFromPayload(GetClass(), Payload.ToSharedRef()));
+			*FHyperlinkUtility::CreateLinkFromPayload(GetClass(), PayloadString));
 	}
 	else
 	{
@@ -72,3 +132,11 @@ void UHyperlinkDefinition::CopyLink(const TSharedRef<FJsonObject>& Payload) cons
 	UE_LOG(LogHyperlink, Display, TEXT("Copied: %s"), *LinkString);
 	FPlatformApplicationMisc::ClipboardCopy(*LinkString);
 }
+
+void UHyperlinkDefinition::CopyLinkFromPayloadString(const FStringView PayloadString) const
+{
+	const FString LinkString
+		{ FHyperlinkUtility::CreateLinkFromPayload(GetClass(), PayloadString) };
+	UE_LOG(LogHyperlink, Display, TEXT("Copied: %s"), *LinkString);
+	FPlatformApplicationMisc::ClipboardCopy(*LinkString);
+}
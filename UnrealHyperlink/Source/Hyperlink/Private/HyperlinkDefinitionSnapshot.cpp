@@ -0,0 +1,52 @@
+﻿// Copyright (c) 2023-2024 Fergus Brown. Licensed under the MIT license. See "LICENSE" file for details.
+
+
+#include "HyperlinkDefinitionSnapshot.h"
+
+#include "HyperlinkDefinition.h"
+
+void FHyperlinkDefinitionSnapshot::Add(const FString& Identifier, UHyperlinkDefinition* const Definition)
+{
+	const UClass* const Class{ Definition->GetClass() };
+	const int32 Index{ Entries.Emplace(FEntry{ Identifier, FObjectKey(Class), Definition,
+		Class->GetDefaultObject<UHyperlinkDefinition>() }) };
+	IdentifierIndices.Emplace(Identifier, Index);
+
+	// An exact class replaces a superclass entry added for an earlier subclass, otherwise the first subclass is kept
+	ClassIndices.Emplace(FObjectKey(Class), Index);
+	for (const UClass* Super{ Class->GetSuperClass() }; Super && Super->IsChildOf<UHyperlinkDefinition>();
+		Super = Super->GetSuperClass())
+	{
+		const FObjectKey SuperKey{ Super };
+		if (ClassIndices.Contains(SuperKey))
+		{
+			// Its superclasses were added along with it
+			break;
+		}
+		ClassIndices.Emplace(SuperKey, Index);
+	}
+}
+
+void FHyperlinkDefinitionSnapshot::AddUnloaded(const FString& Identifier)
+{
+	IdentifierIndices.Emplace(Identifier, Entries.Emplace(FEntry{ Identifier }));
+}
+
+const FHyperlinkDefinitionSnapshot::FEntry* FHyperlinkDefinitionSnapshot::FindByIdentifier(
+	const FString& Identifier) const
+{
+	return FindByIdentifierHash(GetTypeHash(Identifier), Identifier);
+}
+
+const FHyperlinkDefinitionSnapshot::FEntry* FHyperlinkDefinitionSnapshot::FindByIdentifierHash(
+	const uint32 IdentifierHash, const FString& Identifier) const
+{
+	const int32* const Index{ IdentifierIndices.FindByHash(IdentifierHash, Identifier) };
+	return Index ? &Entries[*Index] : nullptr;
+}
+
+const FHyperlinkDefinitionSnapshot::FEntry* FHyperlinkDefinitionSnapshot::FindByClass(const UClass* const Class) const
+{
+	const int32* const Index{ ClassIndices.Find(FObjectKey(Class)) };
+	return Index ? &Entries[*Index] : nullptr;
+}
@@ -0,0 +1,674 @@
+﻿// Copyright (c) 2023-2024 Fergus Brown. Licensed under the MIT license. See "LICENSE" file for details.
+
+
+#include "HyperlinkFormat.h"
+
+#include "HyperlinkDefinition.h"
+#include "HyperlinkExecutePayload.h"
+#include "HyperlinkStats.h"
+#include "JsonObjectConverter.h"
+#include "Misc/Base64.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Serialization/CompactBinary.h"
+#include "Serialization/CompactBinaryValidation.h"
+#include "Serialization/CompactBinaryWriter.h"
+
+namespace FHyperlinkFormatConstants
+{
+	// Binary field names
+	static const FUtf8StringView ClassField{ UTF8TEXTVIEW("Class") };
+	static const FUtf8StringView IdentifierField{ UTF8TEXTVIEW("Id") };
+	static const FUtf8StringView PayloadField{ UTF8TEXTVIEW("Payload") };
+
+	// JSON field names, these match the names FJsonObjectConverter uses for FHyperlinkExecutePayload
+	static const FString JsonClassField{ TEXT("class") };
+	static const FString JsonIdentifierField{ TEXT("identifier") };
+	static const FString JsonPayloadField{ TEXT("definitionPayload") };
+}
+
+namespace FHyperlinkFormatHelpers
+{
+	static void SetName(FCbWriter& Writer, const FString& Name)
+	{
+		const FTCHARToUTF8 Utf8Name{ *Name, Name.Len() };
+		Writer.SetName(FUtf8StringView(reinterpret_cast<const UTF8CHAR*>(Utf8Name.Get()), Utf8Name.Length()));
+	}
+
+	static FString ToString(const FUtf8StringView InString)
+	{
+		return FString(InString.Len(), InString.GetData());
+	}
+
+	static bool IsLineTerminator(const TCHAR Char)
+	{
+		return Char == TEXT('\n') || Char == TEXT('\r');
+	}
+
+	/* Definition classes are always loaded, so find the class rather than loading it. Safe to call off the game thread */
+	static UClass* ResolveDefinitionClass(const FString& ClassPath)
+	{
+		UClass* const Class{ FSoftClassPath(ClassPath).ResolveClass() };
+		return Class != nullptr && Class->IsChildOf<UHyperlinkDefinition>() ? Class : nullptr;
+	}
+
+	static bool IsBase64UrlChar(const TCHAR Char)
+	{
+		return (Char >= TEXT('A') && Char <= TEXT('Z')) || (Char >= TEXT('a') && Char <= TEXT('z'))
+			|| (Char >= TEXT('0') && Char <= TEXT('9')) || Char == TEXT('-') || Char == TEXT('_');
+	}
+
+	static void WriteNumber(FCbWriter& Writer, const double Number)
+	{
+		// Whole numbers are written as integers which compact binary stores in as few bytes as possible
+		const double Integral{ FMath::RoundToDouble(Number) };
+		if (Integral == Number && FMath::Abs(Integral) < static_cast<double>(MAX_int64))
+		{
+			Writer.AddInteger(static_cast<int64>(Integral));
+		}
+		else
+		{
+			Writer.AddFloat(Number);
+		}
+	}
+
+	static void WriteJsonValue(FCbWriter& Writer, const FJsonValue& Value);
+	static TSharedPtr<FJsonValue> ReadJsonValue(const FCbFieldView& Field);
+
+	static void WriteJsonValue(FCbWriter& Writer, const FJsonValue& Value)
+	{
+		switch (Value.Type)
+		{
+		case EJson::String:
+			Writer.AddString(FStringView(Value.AsString()));
+			break;
+		case EJson::Number:
+			WriteNumber(Writer, Value.AsNumber());
+			break;
+		case EJson::Boolean:
+			Writer.AddBool(Value.AsBool());
+			break;
+		case EJson::Array:
+			Writer.BeginArray();
+			for (const TSharedPtr<FJsonValue>& Element : Value.AsArray())
+			{
+				WriteJsonValue(Writer, *Element);
+			}
+			Writer.EndArray();
+			break;
+		case EJson::Object:
+			FHyperlinkFormat::WriteJsonObject(Writer, *Value.AsObject());
+			break;
+		case EJson::None:
+		case EJson::Null:
+		default:
+			Writer.AddNull();
+			break;
+		}
+	}
+
+	static TSharedPtr<FJsonValue> ReadJsonValue(const FCbFieldView& Field)
+	{
+		TSharedPtr<FJsonValue> Value{ nullptr };
+
+		if (Field.IsString())
+		{
+			Value = MakeShared<FJsonValueString>(ToString(Field.AsString()));
+		}
+		else if (Field.IsInteger())
+		{
+			Value = MakeShared<FJsonValueNumber>(static_cast<double>(Field.AsInt64()));
+		}
+		else if (Field.IsFloat())
+		{
+			Value = MakeShared<FJsonValueNumber>(Field.AsDouble());
+		}
+		else if (Field.IsBool())
+		{
+			Value = MakeShared<FJsonValueBoolean>(Field.AsBool());
+		}
+		else if (Field.IsArray())
+		{
+			TArray<TSharedPtr<FJsonValue>> Elements{};
+			for (const FCbFieldView& Element : Field.AsArrayView())
+			{
+				Elements.Emplace(ReadJsonValue(Element));
+			}
+			Value = MakeShared<FJsonValueArray>(MoveTemp(Elements));
+		}
+		else if (Field.IsObject())
+		{
+			Value = MakeShared<FJsonValueObject>(FHyperlinkFormat::ReadJsonObject(Field.AsObjectView()));
+		}
+		else
+		{
+			Value = MakeShared<FJsonValueNull>();
+		}
+
+		return Value;
+	}
+
+	using FJsonStringWriter = TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>;
+
+	static void WriteCbField(FJsonStringWriter& Writer, const FCbFieldView& Field)
+	{
+		if (Field.IsString())
+		{
+			Writer.WriteValue(ToString(Field.AsString()));
+		}
+		else if (Field.IsInteger())
+		{
+			Writer.WriteValue(Field.AsInt64());
+		}
+		else if (Field.IsFloat())
+		{
+			Writer.WriteValue(Field.AsDouble());
+		}
+		else if (Field.IsBool())
+		{
+			Writer.WriteValue(Field.AsBool());
+		}
+		else if (Field.IsArray())
+		{
+			Writer.WriteArrayStart();
+			for (const FCbFieldView& Element : Field.AsArrayView())
+			{
+				WriteCbField(Writer, Element);
+			}
+			Writer.WriteArrayEnd();
+		}
+		else if (Field.IsObject())
+		{
+			Writer.WriteObjectStart();
+			for (const FCbFieldView& Member : Field.AsObjectView())
+			{
+				Writer.WriteIdentifierPrefix(ToString(Member.GetName()));
+				WriteCbField(Writer, Member);
+			}
+			Writer.WriteObjectEnd();
+		}
+		else
+		{
+			Writer.WriteNull();
+		}
+	}
+
+	static int32 SkipJsonWhitespace(const FStringView InJson, int32 Index)
+	{
+		while (Index < InJson.Len() && FChar::IsWhitespace(InJson[Index]))
+		{
+			++Index;
+		}
+		return Index;
+	}
+
+	/* @return index after the closing quote of the JSON string starting at Index, INDEX_NONE if not terminated */
+	static int32 SkipJsonString(const FStringView InJson, int32 Index)
+	{
+		int32 Ret{ INDEX_NONE };
+		for (++Index; Index < InJson.Len(); ++Index)
+		{
+			if (InJson[Index] == TEXT('\\'))
+			{
+				++Index;
+			}
+			else if (InJson[Index] == TEXT('"'))
+			{
+				Ret = Index + 1;
+				break;
+			}
+		}
+		return Ret;
+	}
+
+	/* @return index after the JSON value starting at Index, INDEX_NONE if not terminated */
+	static int32 SkipJsonValue(const FStringView InJson, int32 Index)
+	{
+		int32 Depth{ 0 };
+		while (Index != INDEX_NONE && Index < InJson.Len())
+		{
+			const TCHAR Char{ InJson[Index] };
+			if (Char == TEXT('"'))
+			{
+				Index = SkipJsonString(InJson, Index);
+			}
+			else if (Char == TEXT('{') || Char == TEXT('['))
+			{
+				++Depth;
+				++Index;
+			}
+			else if ((Char == TEXT('}') || Char == TEXT(']')) && Depth > 0)
+			{
+				--Depth;
+				++Index;
+			}
+			else if ((Char == TEXT(',') || Char == TEXT('}')) && Depth == 0)
+			{
+				// End of a number or literal
+				break;
+			}
+			else
+			{
+				++Index;
+			}
+
+			if (Depth == 0 && Index != INDEX_NONE && (Char == TEXT('"') || Char == TEXT('}') || Char == TEXT(']')))
+			{
+				break;
+			}
+		}
+		return Index;
+	}
+
+	/* Remove the quotes from a JSON string which doesn't need unescaping */
+	static bool TryUnquoteJsonString(FStringView& InOutString)
+	{
+		bool bResult{ false };
+		if (InOutString.Len() >= 2 && InOutString.StartsWith(TEXT('"')) && InOutString.EndsWith(TEXT('"')))
+		{
+			int32 BackslashIndex{ INDEX_NONE };
+			if (!InOutString.FindChar(TEXT('\\'), BackslashIndex))
+			{
+				InOutString = InOutString.Mid(1, InOutString.Len() - 2);
+				bResult = true;
+			}
+		}
+		return bResult;
+	}
+
+	/**
+	 * Find the members of the execute payload object in a single pass without deserializing the definition payload
+	 * @return false if the string couldn't be read, e.g. it isn't an object
+	 */
+	static bool TryReadJsonEnvelope(const FStringView InJson, FStringView& OutIdentifier, FStringView& OutClass,
+		FStringView& OutPayload)
+	{
+		int32 Index{ SkipJsonWhitespace(InJson, 0) };
+		bool bValid{ Index < InJson.Len() && InJson[Index] == TEXT('{') };
+		if (bValid)
+		{
+			Index = SkipJsonWhitespace(InJson, Index + 1);
+		}
+		
+		while (bValid && Index < InJson.Len() && InJson[Index] != TEXT('}'))
+		{
+			const int32 KeyStart{ Index };
+			const int32 KeyEnd{ InJson[Index] == TEXT('"') ? SkipJsonString(InJson, Index) : INDEX_NONE };
+			Index = KeyEnd != INDEX_NONE ? SkipJsonWhitespace(InJson, KeyEnd) : INDEX_NONE;
+			
+			bValid = Index != INDEX_NONE && Index < InJson.Len() && InJson[Index] == TEXT(':');
+			if (bValid)
+			{
+				const int32 ValueStart{ SkipJsonWhitespace(InJson, Index + 1) };
+				const int32 ValueEnd{ SkipJsonValue(InJson, ValueStart) };
+				bValid = ValueEnd != INDEX_NONE && ValueEnd > ValueStart;
+				if (bValid)
+				{
+					const FStringView Key{ InJson.Mid(KeyStart + 1, KeyEnd - KeyStart - 2) };
+					const FStringView Value{ InJson.Mid(ValueStart, ValueEnd - ValueStart) };
+					if (Key.Equals(FHyperlinkFormatConstants::JsonIdentifierField, ESearchCase::IgnoreCase))
+					{
+						OutIdentifier = Value;
+					}
+					else if (Key.Equals(FHyperlinkFormatConstants::JsonClassField, ESearchCase::IgnoreCase))
+					{
+						OutClass = Value;
+					}
+					else if (Key.Equals(FHyperlinkFormatConstants::JsonPayloadField, ESearchCase::IgnoreCase))
+					{
+						OutPayload = Value;
+					}
+					
+					Index = SkipJsonWhitespace(InJson, ValueEnd);
+					if (Index < InJson.Len() && InJson[Index] == TEXT(','))
+					{
+						Index = SkipJsonWhitespace(InJson, Index + 1);
+					}
+				}
+			}
+		}
+		
+		return bValid && Index < InJson.Len() && OutPayload.StartsWith(TEXT('{'));
+	}
+}
+
+FString FHyperlinkFormat::SerializeExecutePayload(const FHyperlinkExecutePayload& InPayload,
+	const EHyperlinkLinkFormat Format)
+{
+	FString PayloadString{};
+
+	if (Format == EHyperlinkLinkFormat::Binary)
+	{
+		PayloadString = SerializeBinary(InPayload);
+	}
+	else
+	{
+		PayloadString = SerializeJson(InPayload);
+	}
+
+	return PayloadString;
+}
+
+bool FHyperlinkFormat::TryDeserializeExecutePayload(const FStringView InPayloadString,
+	FHyperlinkExecutePayload& OutPayload)
+{
+	HYPERLINK_SCOPE_CYCLE_COUNTER(STAT_HyperlinkExtractPayload);
+	
+	bool bResult{ false };
+
+	if (InPayloadString.StartsWith(BinaryPrefix))
+	{
+		bResult = TryDeserializeBinary(InPayloadString, OutPayload);
+	}
+	else if (InPayloadString.StartsWith(TEXT('{')))
+	{
+		FStringView Identifier{};
+		FStringView ClassPath{};
+		FStringView DefinitionPayload{};
+		if (FHyperlinkFormatHelpers::TryReadJsonEnvelope(InPayloadString, Identifier, ClassPath, DefinitionPayload)
+			&& (Identifier.IsEmpty() || FHyperlinkFormatHelpers::TryUnquoteJsonString(Identifier))
+			&& (ClassPath.IsEmpty() || FHyperlinkFormatHelpers::TryUnquoteJsonString(ClassPath)))
+		{
+			// The definition payload is kept as a string for the definition to read
+			if (!Identifier.IsEmpty())
+			{
+				OutPayload.Identifier = FString(Identifier);
+			}
+			else if (!ClassPath.IsEmpty())
+			{
+				OutPayload.Class = FHyperlinkFormatHelpers::ResolveDefinitionClass(FString(ClassPath));
+			}
+			OutPayload.DefinitionPayload.JsonString = FString(DefinitionPayload);
+			bResult = !OutPayload.Identifier.IsEmpty() || OutPayload.Class != nullptr;
+		}
+		else
+		{
+			// Fall back to the DOM for anything the envelope reader doesn't handle e.g. escaped characters
+			TSharedPtr<FJsonObject> RootObject{};
+			const TSharedRef<TJsonReader<TCHAR>> JsonReader{ TJsonReaderFactory<TCHAR>::CreateFromView(InPayloadString) };
+			bResult = FJsonSerializer::Deserialize(JsonReader, RootObject) && RootObject.IsValid()
+				&& FJsonObjectConverter::JsonObjectToUStruct(RootObject.ToSharedRef(), &OutPayload);
+		}
+	}
+
+	return bResult;
+}
+
+bool FHyperlinkFormat::TryFindPayloadString(const FStringView InString, FStringView& OutPayloadString)
+{
+	bool bResult{ false };
+	
+	int32 End{ InString.Len() };
+	while (End > 0 && FHyperlinkFormatHelpers::IsLineTerminator(InString[End - 1]))
+	{
+		--End;
+	}
+	
+	if (End > 0 && InString[End - 1] == TEXT('}'))
+	{
+		// JSON: from the first '{' on the last line to the final '}'
+		int32 LineStart{ End - 1 };
+		while (LineStart > 0 && !FHyperlinkFormatHelpers::IsLineTerminator(InString[LineStart - 1]))
+		{
+			--LineStart;
+		}
+		
+		const FStringView Line{ InString.Mid(LineStart, End - LineStart) };
+		int32 BraceIndex{ INDEX_NONE };
+		if (Line.FindChar(TEXT('{'), BraceIndex))
+		{
+			OutPayloadString = Line.RightChop(BraceIndex);
+			bResult = true;
+		}
+	}
+	else
+	{
+		// Binary: the prefix followed by a run of base64url characters
+		int32 Start{ End };
+		while (Start > 0 && FHyperlinkFormatHelpers::IsBase64UrlChar(InString[Start - 1]))
+		{
+			--Start;
+		}
+		
+		if (Start > 0 && Start < End && InString[Start - 1] == BinaryPrefix)
+		{
+			OutPayloadString = InString.Mid(Start - 1, End - Start + 1);
+			bResult = true;
+		}
+	}
+	
+	return bResult;
+}
+
+void FHyperlinkFormat::WriteJsonObject(FCbWriter& Writer, const FJsonObject& InObject)
+{
+	Writer.BeginObject();
+	for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : InObject.Values)
+	{
+		if (Pair.Value.IsValid())
+		{
+			FHyperlinkFormatHelpers::SetName(Writer, Pair.Key);
+			FHyperlinkFormatHelpers::WriteJsonValue(Writer, *Pair.Value);
+		}
+	}
+	Writer.EndObject();
+}
+
+TSharedRef<FJsonObject> FHyperlinkFormat::ReadJsonObject(const FCbObjectView& InObject)
+{
+	TSharedRef<FJsonObject> Object{ MakeShared<FJsonObject>() };
+	for (const FCbFieldView& Field : InObject)
+	{
+		Object->SetField(FHyperlinkFormatHelpers::ToString(Field.GetName()),
+			FHyperlinkFormatHelpers::ReadJsonValue(Field));
+	}
+	return Object;
+}
+
+bool FHyperlinkFormat::WriteJsonString(FCbWriter& Writer, const FStringView InJsonString)
+{
+	// The root must be an object
+	bool bResult{ InJsonString.TrimStart().StartsWith(TEXT('{')) };
+	int32 Depth{ 0 };
+
+	const TSharedRef<TJsonReader<TCHAR>> JsonReader{ TJsonReaderFactory<TCHAR>::CreateFromView(InJsonString) };
+	EJsonNotation Notation{ EJsonNotation::Error };
+	while (bResult && JsonReader->ReadNext(Notation))
+	{
+		if (Notation != EJsonNotation::ObjectEnd && Notation != EJsonNotation::ArrayEnd
+			&& !JsonReader->GetIdentifier().IsEmpty())
+		{
+			FHyperlinkFormatHelpers::SetName(Writer, JsonReader->GetIdentifier());
+		}
+		
+		switch (Notation)
+		{
+		case EJsonNotation::ObjectStart:
+			Writer.BeginObject();
+			++Depth;
+			break;
+		case EJsonNotation::ObjectEnd:
+			Writer.EndObject();
+			--Depth;
+			break;
+		case EJsonNotation::ArrayStart:
+			Writer.BeginArray();
+			++Depth;
+			break;
+		case EJsonNotation::ArrayEnd:
+			Writer.EndArray();
+			--Depth;
+			break;
+		case EJsonNotation::String:
+			Writer.AddString(FStringView(JsonReader->GetValueAsString()));
+			break;
+		case EJsonNotation::Number:
+			FHyperlinkFormatHelpers::WriteNumber(Writer, JsonReader->GetValueAsNumber());
+			break;
+		case EJsonNotation::Boolean:
+			Writer.AddBool(JsonReader->GetValueAsBoolean());
+			break;
+		case EJsonNotation::Null:
+			Writer.AddNull();
+			break;
+		default:
+			bResult = false;
+			break;
+		}
+	}
+
+	return bResult && Depth == 0 && JsonReader->GetErrorMessage().IsEmpty();
+}
+
+void FHyperlinkFormat::ReadJsonString(const FCbObjectView& InObject, FString& OutJsonString)
+{
+	const TSharedRef<FHyperlinkFormatHelpers::FJsonStringWriter> JsonWriter
+		{ TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&OutJsonString) };
+	JsonWriter->WriteObjectStart();
+	for (const FCbFieldView& Member : InObject)
+	{
+		JsonWriter->WriteIdentifierPrefix(FHyperlinkFormatHelpers::ToString(Member.GetName()));
+		FHyperlinkFormatHelpers::WriteCbField(*JsonWriter, Member);
+	}
+	JsonWriter->WriteObjectEnd();
+	JsonWriter->Close();
+}
+
+FString FHyperlinkFormat::SerializeJson(const FHyperlinkExecutePayload& InPayload)
+{
+	FString PayloadString{};
+
+	const FJsonObjectWrapper& DefinitionPayload{ InPayload.DefinitionPayload };
+	if (DefinitionPayload.JsonObject.IsValid() || !DefinitionPayload.JsonString.IsEmpty())
+	{
+		const TSharedRef<FHyperlinkFormatHelpers::FJsonStringWriter> JsonWriter
+			{ TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&PayloadString) };
+		JsonWriter->WriteObjectStart();
+		
+		// Only one of the identifier or class is written to keep the link short
+		if (!InPayload.Identifier.IsEmpty())
+		{
+			JsonWriter->WriteValue(FHyperlinkFormatConstants::JsonIdentifierField, InPayload.Identifier);
+		}
+		else if (InPayload.Class)
+		{
+			JsonWriter->WriteValue(FHyperlinkFormatConstants::JsonClassField, InPayload.Class->GetPathName());
+		}
+		
+		// Prefer the object if there is one, otherwise the string is already JSON so it's written as is
+		if (DefinitionPayload.JsonObject.IsValid())
+		{
+			JsonWriter->WriteIdentifierPrefix(FHyperlinkFormatConstants::JsonPayloadField);
+			FJsonSerializer::Serialize(DefinitionPayload.JsonObject.ToSharedRef(), JsonWriter, false);
+		}
+		else
+		{
+			JsonWriter->WriteRawJSONValue(FHyperlinkFormatConstants::JsonPayloadField, DefinitionPayload.JsonString);
+		}
+		
+		JsonWriter->WriteObjectEnd();
+		JsonWriter->Close();
+	}
+
+	return PayloadString;
+}
+
+FString FHyperlinkFormat::SerializeBinary(const FHyperlinkExecutePayload& InPayload)
+{
+	FString PayloadString{};
+
+	const FJsonObjectWrapper& DefinitionPayload{ InPayload.DefinitionPayload };
+	if ((!InPayload.Identifier.IsEmpty() || InPayload.Class)
+		&& (DefinitionPayload.JsonObject.IsValid() || !DefinitionPayload.JsonString.IsEmpty()))
+	{
+		bool bPayloadWritten{ true };
+		FCbWriter Writer{};
+		Writer.BeginObject();
+		if (!InPayload.Identifier.IsEmpty())
+		{
+			Writer.SetName(FHyperlinkFormatConstants::IdentifierField);
+			Writer.AddString(FStringView(InPayload.Identifier));
+		}
+		else
+		{
+			Writer.SetName(FHyperlinkFormatConstants::ClassField);
+			Writer.AddString(FStringView(InPayload.Class->GetPathName()));
+		}
+		Writer.SetName(FHyperlinkFormatConstants::PayloadField);
+		if (DefinitionPayload.JsonObject.IsValid())
+		{
+			WriteJsonObject(Writer, *DefinitionPayload.JsonObject);
+		}
+		else
+		{
+			bPayloadWritten = WriteJsonString(Writer, DefinitionPayload.JsonString);
+		}
+
+		// The writer is abandoned if the payload string wasn't valid JSON
+		if (bPayloadWritten)
+		{
+			Writer.EndObject();
+
+			// Version byte followed by the compact binary object
+			TArray<uint8> Buffer{};
+			const uint64 SaveSize{ Writer.GetSaveSize() };
+			Buffer.SetNumUninitialized(1 + static_cast<int32>(SaveSize));
+			Buffer[0] = BinaryVersion;
+			Writer.Save(FMutableMemoryView(Buffer.GetData() + 1, SaveSize));
+
+			// Padding is implied by the length so it's stripped to avoid escaping '='
+			FString Encoded{ FBase64::Encode(Buffer.GetData(), Buffer.Num(), EBase64Mode::UrlSafe) };
+			int32 PaddingStart{ Encoded.Len() };
+			while (PaddingStart > 0 && Encoded[PaddingStart - 1] == TEXT('='))
+			{
+				--PaddingStart;
+			}
+
+			PayloadString.Reserve(PaddingStart + 1);
+			PayloadString.AppendChar(BinaryPrefix);
+			PayloadString.Append(*Encoded, PaddingStart);
+		}
+	}
+
+	return PayloadString;
+}
+
+bool FHyperlinkFormat::TryDeserializeBinary(const FStringView InPayloadString, FHyperlinkExecutePayload& OutPayload)
+{
+	bool bResult{ false };
+
+	// Decode into an inline buffer, the raw decode accepts the unpadded string written by SerializeBinary
+	const FStringView Encoded{ InPayloadString.RightChop(1) };
+	TArray<uint8, TInlineAllocator<512>> Buffer{};
+	Buffer.SetNumUninitialized(static_cast<int32>(FBase64::GetDecodedDataSize(Encoded.GetData(), Encoded.Len())));
+	if (FBase64::Decode(Encoded.GetData(), Encoded.Len(), Buffer.GetData(), EBase64Mode::UrlSafe)
+		&& Buffer.Num() > 1 && Buffer[0] == BinaryVersion)
+	{
+		const FMemoryView ObjectView{ Buffer.GetData() + 1, static_cast<uint64>(Buffer.Num() - 1) };
+		if (ValidateCompactBinary(ObjectView, ECbValidateMode::Default) == ECbValidateError::None)
+		{
+			const FCbObjectView Object{ FCbFieldView(ObjectView.GetData()).AsObjectView() };
+			const FCbFieldView IdentifierField{ Object[FHyperlinkFormatConstants::IdentifierField] };
+			const FCbFieldView ClassField{ Object[FHyperlinkFormatConstants::ClassField] };
+			const FCbFieldView PayloadField{ Object[FHyperlinkFormatConstants::PayloadField] };
+
+			if (PayloadField.IsObject())
+			{
+				// The class path is only resolved when the link doesn't carry an identifier
+				if (IdentifierField.IsString())
+				{
+					OutPayload.Identifier = FHyperlinkFormatHelpers::ToString(IdentifierField.AsString());
+				}
+				else if (ClassField.IsString())
+				{
+					OutPayload.Class = FHyperlinkFormatHelpers::ResolveDefinitionClass(
+						FHyperlinkFormatHelpers::ToString(ClassField.AsString()));
+				}
+				// The definition payload is kept as a string for the definition to read
+				ReadJsonString(PayloadField.AsObjectView(), OutPayload.DefinitionPayload.JsonString);
+				bResult = !OutPayload.Identifier.IsEmpty() || OutPayload.Class != nullptr;
+			}
+		}
+	}
+
+	return bResult;
+}
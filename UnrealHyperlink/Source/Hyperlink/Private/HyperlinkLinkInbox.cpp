@@ -0,0 +1,38 @@
+﻿// Copyright (c) 2023-2024 Fergus Brown. Licensed under the MIT license. See "LICENSE" file for details.
+
+
+#include "HyperlinkLinkInbox.h"
+
+FHyperlinkLinkInbox::FHyperlinkLinkInbox(const int32 InCapacity)
+	: Capacity{ FMath::Max(InCapacity, 1) }
+{
+}
+
+// NOLINTNEXTLINE(performance-unnecessary-value-param) : moved into the queue
+bool FHyperlinkLinkInbox::Push(FHyperlinkExecutePayload Payload)
+{
+	// Reserve a slot first, so concurrent producers can't overfill the queue between checking and pushing
+	const bool bResult{ NumQueued.fetch_add(1, std::memory_order_relaxed) < Capacity };
+	if (bResult)
+	{
+		Queue.Enqueue(MoveTemp(Payload));
+	}
+	else
+	{
+		NumQueued.fetch_sub(1, std::memory_order_relaxed);
+		NumDropped.fetch_add(1, std::memory_order_relaxed);
+	}
+	return bResult;
+}
+
+bool FHyperlinkLinkInbox::Pop(FHyperlinkExecutePayload& OutPayload)
+{
+	TOptional<FHyperlinkExecutePayload> Payload{ Queue.Dequeue() };
+	const bool bResult{ Payload.IsSet() };
+	if (bResult)
+	{
+		OutPayload = MoveTemp(Payload.GetValue());
+		NumQueued.fetch_sub(1, std::memory_order_relaxed);
+	}
+	return bResult;
+}
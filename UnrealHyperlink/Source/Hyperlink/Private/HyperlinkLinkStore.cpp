@@ -0,0 +1,511 @@
+﻿// Copyright (c) 2023-2024 Fergus Brown. Licensed under the MIT license. See "LICENSE" file for details.
+
+
+#include "HyperlinkLinkStore.h"
+
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "HyperlinkStats.h"
+#include "LogHyperlink.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+
+/*
+ * Segment layout, all values little endian:
+ *	uint32 Magic, uint32 Version
+ *	Records: uint64 HashLow, uint64 HashHigh, int64 Timestamp (unix seconds), uint32 PayloadSize, UTF-8 payload
+ */
+namespace FHyperlinkLinkStoreConstants
+{
+	static constexpr uint32 Magic{ 0x534C4855 }; // "UHLS"
+	static constexpr uint32 Version{ 1 };
+	static constexpr int64 HeaderSize{ sizeof(uint32) * 2 };
+	static constexpr int64 RecordHeaderSize{ sizeof(uint64) * 2 + sizeof(int64) + sizeof(uint32) };
+	static const FString SegmentExtension{ TEXT(".links") };
+	/* Minimum time between rescans of the store directory for payloads which aren't found */
+	static constexpr double RescanIntervalSeconds{ 1.0 };
+	/* This user's segment is compacted after this many appends, so long editor sessions don't grow it unbounded */
+	static constexpr int32 CompactAppendInterval{ 256 };
+}
+
+namespace FHyperlinkLinkStoreHelpers
+{
+	struct FRecord
+	{
+		FXxHash128 Hash{};
+		int64 Timestamp{ 0 };
+		int64 PayloadOffset{ 0 };
+		uint32 PayloadSize{ 0 };
+	};
+
+	template<typename T>
+	static T ReadValue(const uint8* const Data)
+	{
+		T Value;
+		FMemory::Memcpy(&Value, Data, sizeof(T));
+		return Value;
+	}
+
+	template<typename T>
+	static void AppendValue(TArray<uint8>& OutData, const T Value)
+	{
+		OutData.Append(reinterpret_cast<const uint8*>(&Value), sizeof(T));
+	}
+
+	static void WriteHeader(TArray<uint8>& OutData)
+	{
+		AppendValue(OutData, FHyperlinkLinkStoreConstants::Magic);
+		AppendValue(OutData, FHyperlinkLinkStoreConstants::Version);
+	}
+
+	static void WriteRecord(TArray<uint8>& OutData, const FXxHash128& Hash, const int64 Timestamp,
+		const uint8* const Payload, const uint32 PayloadSize)
+	{
+		AppendValue(OutData, Hash.HashLow);
+		AppendValue(OutData, Hash.HashHigh);
+		AppendValue(OutData, Timestamp);
+		AppendValue(OutData, PayloadSize);
+		OutData.Append(Payload, PayloadSize);
+	}
+
+	/**
+	 * @brief Visit each complete record in a segment. A record cut short by an interrupted write ends the segment
+	 * @return false if the segment header is invalid
+	 */
+	static bool ForEachRecord(const uint8* const Data, const int64 Size, const TFunctionRef<void(const FRecord&)> Visitor)
+	{
+		using namespace FHyperlinkLinkStoreConstants;
+		
+		const bool bValidHeader{ Size >= HeaderSize && ReadValue<uint32>(Data) == Magic
+			&& ReadValue<uint32>(Data + sizeof(uint32)) == Version };
+		if (bValidHeader)
+		{
+			int64 Offset{ HeaderSize };
+			while (Offset + RecordHeaderSize <= Size)
+			{
+				FRecord Record{};
+				Record.Hash.HashLow = ReadValue<uint64>(Data + Offset);
+				Record.Hash.HashHigh = ReadValue<uint64>(Data + Offset + sizeof(uint64));
+				Record.Timestamp = ReadValue<int64>(Data + Offset + sizeof(uint64) * 2);
+				Record.PayloadSize = ReadValue<uint32>(Data + Offset + sizeof(uint64) * 3);
+				Record.PayloadOffset = Offset + RecordHeaderSize;
+				
+				if (Record.PayloadOffset + Record.PayloadSize > Size)
+				{
+					break;
+				}
+				
+				Visitor(Record);
+				Offset = Record.PayloadOffset + Record.PayloadSize;
+			}
+		}
+		
+		return bValidHeader;
+	}
+
+	static int64 GetUnixNow()
+	{
+		return FDateTime::UtcNow().ToUnixTimestamp();
+	}
+}
+
+FHyperlinkLinkStore::FHyperlinkLinkStore(const FString& InDirectory, const FTimespan& InTimeToLive)
+	: Directory{ InDirectory }
+	, TimeToLive{ InTimeToLive }
+{
+	const FString SegmentName{ FString::Printf(TEXT("%s-%s"), FPlatformProcess::ComputerName(),
+		FPlatformProcess::UserName()) };
+	OwnSegmentFilename = Directory / FPaths::MakeValidFileName(SegmentName)
+		+ FHyperlinkLinkStoreConstants::SegmentExtension;
+	
+	RescanSegments(/*bForce = */true);
+}
+
+FString FHyperlinkLinkStore::Store(const FStringView InPayloadString)
+{
+	LLM_SCOPE_BYTAG(Hyperlink);
+	FScopeLock Lock{ &CriticalSection };
+	
+	const FTCHARToUTF8 Utf8Payload{ InPayloadString.GetData(), InPayloadString.Len() };
+	const FXxHash128 Hash{ FXxHash128::HashBuffer(Utf8Payload.Get(), Utf8Payload.Length()) };
+	
+	const FRecordLocation* const Location{ Index.Find(Hash) };
+	const bool bStored{ Location && !NeedsRewrite(*Location) };
+	
+	FString HashString{};
+	if (bStored || AppendRecord(Hash, reinterpret_cast<const uint8*>(Utf8Payload.Get()), Utf8Payload.Length()))
+	{
+		HashString = HashToString(Hash);
+	}
+	
+	return HashString;
+}
+
+bool FHyperlinkLinkStore::Touch(const FStringView InHash)
+{
+	LLM_SCOPE_BYTAG(Hyperlink);
+	FScopeLock Lock{ &CriticalSection };
+	
+	bool bResult{ false };
+	
+	FXxHash128 Hash{};
+	const FRecordLocation* const Location{ TryParseHash(InHash, Hash) ? Index.Find(Hash) : nullptr };
+	if (Location && NeedsRewrite(*Location))
+	{
+		// Copied because appending can reallocate this user's segment, which may hold the payload
+		const TArray<uint8> Payload{ Segments[Location->SegmentIndex].Data.GetData() + Location->PayloadOffset,
+			static_cast<int32>(Location->PayloadSize) };
+		bResult = AppendRecord(Hash, Payload.GetData(), Payload.Num());
+	}
+	else
+	{
+		bResult = Location != nullptr;
+	}
+	
+	return bResult;
+}
+
+bool FHyperlinkLinkStore::TryResolve(const FStringView InHash, FString& OutPayloadString)
+{
+	FScopeLock Lock{ &CriticalSection };
+	
+	bool bResult{ false };
+
+	FXxHash128 Hash{};
+	if (TryParseHash(InHash, Hash))
+	{
+		const FRecordLocation* Location{ Index.Find(Hash) };
+		
+		// The payload may have been added by syncing the store directory since it was loaded. Anyone can request
+		// unknown hashes, so rescanning is rate limited and only reads segments which changed
+		if (!Location
+			&& FPlatformTime::Seconds() - LastRescanTime >= FHyperlinkLinkStoreConstants::RescanIntervalSeconds)
+		{
+			RescanSegments(/*bForce = */false);
+			Location = Index.Find(Hash);
+		}
+		
+		if (Location)
+		{
+			const uint8* const Payload{ Segments[Location->SegmentIndex].Data.GetData() + Location->PayloadOffset };
+			
+			// Check the payload hasn't been corrupted
+			if (FXxHash128::HashBuffer(Payload, Location->PayloadSize) == Hash)
+			{
+				const FUTF8ToTCHAR Converted{ reinterpret_cast<const ANSICHAR*>(Payload),
+					static_cast<int32>(Location->PayloadSize) };
+				OutPayloadString = FString(Converted.Length(), Converted.Get());
+				bResult = true;
+			}
+			else
+			{
+				UE_LOG(LogHyperlink, Error, TEXT("Stored link payload %s is corrupt in %s"), *FString(InHash),
+					*Segments[Location->SegmentIndex].Filename);
+			}
+		}
+	}
+
+	return bResult;
+}
+
+/*static*/bool FHyperlinkLinkStore::TryFindHash(const FStringView InString, FStringView& OutHash)
+{
+	bool bResult{ false };
+	
+	FStringView Link{ InString.TrimEnd() };
+	Link.RemoveSuffix(Link.EndsWith(TEXT('/')) ? 1 : 0);
+	
+	// Look for "[/]h/<hash>" at the end of the string
+	if (Link.Len() >= HashLength + 2)
+	{
+		const FStringView Hash{ Link.Right(HashLength) };
+		const FStringView Prefix{ Link.LeftChop(HashLength) };
+		const int32 PrefixLen{ Prefix.Len() };
+		
+		bResult = Prefix[PrefixLen - 1] == TEXT('/') && Prefix[PrefixLen - 2] == LinkPathSegment
+			&& (PrefixLen == 2 || Prefix[PrefixLen - 3] == TEXT('/'));
+		for (int32 Idx{ 0 }; bResult && Idx < Hash.Len(); ++Idx)
+		{
+			bResult = FChar::IsHexDigit(Hash[Idx]);
+		}
+
+		if (bResult)
+		{
+			OutHash = Hash;
+		}
+	}
+
+	return bResult;
+}
+
+void FHyperlinkLinkStore::Compact()
+{
+	using namespace FHyperlinkLinkStoreHelpers;
+	
+	FScopeLock Lock{ &CriticalSection };
+
+	const int32 OwnSegmentIndex{ FindOwnSegment() };
+	if (OwnSegmentIndex != INDEX_NONE)
+	{
+		FSegment& OwnSegment{ Segments[OwnSegmentIndex] };
+		const int64 Now{ GetUnixNow() };
+		
+		// Keep records which haven't expired or been superseded by a newer copy
+		TArray<uint8> CompactedData{};
+		WriteHeader(CompactedData);
+		int32 NumRemoved{ 0 };
+		ForEachRecord(OwnSegment.Data.GetData(), OwnSegment.Data.Num(), [&](const FRecord& Record)
+		{
+			const FRecordLocation& Location{ Index.FindChecked(Record.Hash) };
+			if (Location.SegmentIndex == OwnSegmentIndex && Location.PayloadOffset == Record.PayloadOffset
+				&& !IsExpired(Record.Timestamp, Now))
+			{
+				WriteRecord(CompactedData, Record.Hash, Record.Timestamp,
+					OwnSegment.Data.GetData() + Record.PayloadOffset, Record.PayloadSize);
+			}
+			else
+			{
+				++NumRemoved;
+			}
+		});
+
+		NumAppendsSinceCompact = 0;
+		if (NumRemoved > 0)
+		{
+			const FString TempFilename{ OwnSegmentFilename + TEXT(".tmp") };
+			if (FFileHelper::SaveArrayToFile(CompactedData, *TempFilename)
+				&& IFileManager::Get().Move(*OwnSegmentFilename, *TempFilename, /*bReplace = */true))
+			{
+				UE_LOG(LogHyperlink, Display, TEXT("Removed %d expired link payloads from %s"), NumRemoved,
+					*OwnSegmentFilename);
+				
+				OwnSegment.Data = MoveTemp(CompactedData);
+				UpdateSegmentStat(OwnSegment);
+				RebuildIndex();
+			}
+			else
+			{
+				UE_LOG(LogHyperlink, Warning, TEXT("Failed to compact link store segment %s"), *OwnSegmentFilename);
+			}
+		}
+	}
+}
+
+void FHyperlinkLinkStore::Refresh()
+{
+	FScopeLock Lock{ &CriticalSection };
+	RescanSegments(/*bForce = */true);
+}
+
+void FHyperlinkLinkStore::RescanSegments(const bool bForce)
+{
+	IPlatformFile& PlatformFile{ FPlatformFileManager::Get().GetPlatformFile() };
+	LastRescanTime = FPlatformTime::Seconds();
+	
+	TArray<FString> SegmentNames{};
+	IFileManager::Get().FindFiles(SegmentNames, *(Directory / TEXT("*") + FHyperlinkLinkStoreConstants::SegmentExtension),
+		/*Files = */true, /*Directories = */false);
+
+	// Compare sizes and timestamps first so nothing is read unless a segment has been added, removed or changed
+	TArray<FFileStatData> Stats{};
+	Stats.Reserve(SegmentNames.Num());
+	bool bChanged{ bForce || SegmentNames.Num() != Segments.Num() };
+	for (const FString& SegmentName : SegmentNames)
+	{
+		const FString Filename{ Directory / SegmentName };
+		const FFileStatData& Stat{ Stats.Emplace_GetRef(PlatformFile.GetStatData(*Filename)) };
+		const FSegment* const Segment{ Segments.FindByPredicate([&Filename](const FSegment& Candidate)
+			{ return Candidate.Filename == Filename; }) };
+		bChanged |= !Segment || Segment->FileSize != Stat.FileSize || Segment->Timestamp != Stat.ModificationTime;
+	}
+
+	if (bChanged)
+	{
+		TArray<FSegment> NewSegments{};
+		NewSegments.Reserve(SegmentNames.Num());
+		for (int32 Idx{ 0 }; Idx < SegmentNames.Num(); ++Idx)
+		{
+			const FString Filename{ Directory / SegmentNames[Idx] };
+			const FFileStatData& Stat{ Stats[Idx] };
+			FSegment* const Segment{ Segments.FindByPredicate([&Filename](const FSegment& Candidate)
+				{ return Candidate.Filename == Filename; }) };
+			if (!bForce && Segment && Segment->FileSize == Stat.FileSize && Segment->Timestamp == Stat.ModificationTime)
+			{
+				NewSegments.Emplace(MoveTemp(*Segment));
+			}
+			else
+			{
+				// Read into memory rather than mapped so the file isn't locked while source control replaces it
+				FSegment& NewSegment{ NewSegments.Emplace_GetRef() };
+				NewSegment.Filename = Filename;
+				if (FFileHelper::LoadFileToArray(NewSegment.Data, *Filename, FILEREAD_Silent))
+				{
+					NewSegment.FileSize = Stat.FileSize;
+					NewSegment.Timestamp = Stat.ModificationTime;
+				}
+				else
+				{
+					// Read again on the next rescan, e.g. if the file was being synced
+					NewSegment.Data.Reset();
+				}
+			}
+		}
+		
+		Segments = MoveTemp(NewSegments);
+		RebuildIndex();
+	}
+}
+
+void FHyperlinkLinkStore::RebuildIndex()
+{
+	Index.Reset();
+	for (int32 Idx{ 0 }; Idx < Segments.Num(); ++Idx)
+	{
+		IndexSegment(Idx);
+	}
+}
+
+void FHyperlinkLinkStore::IndexSegment(const int32 SegmentIndex)
+{
+	const FSegment& Segment{ Segments[SegmentIndex] };
+	
+	const bool bValid{ FHyperlinkLinkStoreHelpers::ForEachRecord(Segment.Data.GetData(), Segment.Data.Num(),
+		[this, SegmentIndex](const FHyperlinkLinkStoreHelpers::FRecord& Record)
+		{
+			IndexRecord(Record.Hash, { SegmentIndex, Record.PayloadOffset, Record.PayloadSize, Record.Timestamp });
+		}) };
+
+	// Empty segments haven't had their header written yet
+	UE_CLOG(!bValid && Segment.Data.Num() > 0, LogHyperlink, Warning,
+		TEXT("Ignoring link store segment %s with unsupported version"), *Segment.Filename);
+}
+
+void FHyperlinkLinkStore::IndexRecord(const FXxHash128& Hash, const FRecordLocation& InLocation)
+{
+	// Keep the newest copy of each payload so compaction can remove the others
+	FRecordLocation& Location{ Index.FindOrAdd(Hash) };
+	if (Location.SegmentIndex == INDEX_NONE || Location.Timestamp <= InLocation.Timestamp)
+	{
+		Location = InLocation;
+	}
+}
+
+void FHyperlinkLinkStore::UpdateSegmentStat(FSegment& Segment)
+{
+	const FFileStatData Stat{ FPlatformFileManager::Get().GetPlatformFile().GetStatData(*Segment.Filename) };
+	Segment.FileSize = Stat.FileSize;
+	Segment.Timestamp = Stat.ModificationTime;
+}
+
+int32 FHyperlinkLinkStore::FindOwnSegment() const
+{
+	return Segments.IndexOfByPredicate([this](const FSegment& Segment)
+		{ return Segment.Filename == OwnSegmentFilename; });
+}
+
+bool FHyperlinkLinkStore::AppendRecord(const FXxHash128& Hash, const uint8* const Payload, const uint32 PayloadSize)
+{
+	using namespace FHyperlinkLinkStoreHelpers;
+	
+	bool bResult{ false };
+
+	IPlatformFile& PlatformFile{ FPlatformFileManager::Get().GetPlatformFile() };
+	PlatformFile.CreateDirectoryTree(*Directory);
+	
+	// The in memory copy of this user's segment is appended to alongside the file, so only reload it if something
+	// else has changed the file, e.g. it was deleted
+	int32 OwnSegmentIndex{ FindOwnSegment() };
+	const int64 FileSize{ PlatformFile.FileSize(*OwnSegmentFilename) };
+	if ((OwnSegmentIndex == INDEX_NONE ? -1 : Segments[OwnSegmentIndex].FileSize) != FileSize)
+	{
+		RescanSegments(/*bForce = */false);
+		OwnSegmentIndex = FindOwnSegment();
+	}
+	
+	// Appending to a segment which couldn't be read would leave the copy in memory out of step with the file
+	const bool bUnread{ FileSize > 0
+		&& (OwnSegmentIndex == INDEX_NONE || Segments[OwnSegmentIndex].FileSize != FileSize) };
+	
+	// The header is only written to a new file, the copy in memory is empty if it couldn't be read
+	TArray<uint8> Data{};
+	if (FileSize <= 0)
+	{
+		WriteHeader(Data);
+	}
+	const int64 RecordOffset{ Data.Num() };
+	const int64 Timestamp{ GetUnixNow() };
+	WriteRecord(Data, Hash, Timestamp, Payload, PayloadSize);
+	
+	TUniquePtr<IFileHandle> File
+		{ !bUnread ? PlatformFile.OpenWrite(*OwnSegmentFilename, /*bAppend = */true) : nullptr };
+	if (File.IsValid())
+	{
+		bResult = File->Write(Data.GetData(), Data.Num());
+		File.Reset();
+	}
+	
+	if (bResult)
+	{
+		if (OwnSegmentIndex == INDEX_NONE)
+		{
+			OwnSegmentIndex = Segments.Emplace();
+			Segments[OwnSegmentIndex].Filename = OwnSegmentFilename;
+		}
+		
+		FSegment& OwnSegment{ Segments[OwnSegmentIndex] };
+		const int64 PayloadOffset
+			{ OwnSegment.Data.Num() + RecordOffset + FHyperlinkLinkStoreConstants::RecordHeaderSize };
+		OwnSegment.Data.Append(Data);
+		UpdateSegmentStat(OwnSegment);
+		IndexRecord(Hash, { OwnSegmentIndex, PayloadOffset, PayloadSize, Timestamp });
+		
+		if (++NumAppendsSinceCompact >= FHyperlinkLinkStoreConstants::CompactAppendInterval)
+		{
+			Compact();
+		}
+	}
+	
+	UE_CLOG(!bResult && bUnread, LogHyperlink, Error, TEXT("Not writing link payload to %s, it couldn't be read"),
+		*OwnSegmentFilename);
+	UE_CLOG(!bResult && !bUnread, LogHyperlink, Error, TEXT("Failed to write link payload to %s"), *OwnSegmentFilename);
+	
+	return bResult;
+}
+
+bool FHyperlinkLinkStore::NeedsRewrite(const FRecordLocation& Location) const
+{
+	// Write the payload again once it's half way to expiring so links which are still being shared are kept
+	const int64 HalfTimeToLive{ static_cast<int64>(TimeToLive.GetTotalSeconds() / 2.0) };
+	return IsExpired(Location.Timestamp - HalfTimeToLive, FHyperlinkLinkStoreHelpers::GetUnixNow());
+}
+
+bool FHyperlinkLinkStore::IsExpired(const int64 Timestamp, const int64 Now) const
+{
+	return TimeToLive > FTimespan::Zero() && Now - Timestamp > TimeToLive.GetTotalSeconds();
+}
+
+/*static*/FString FHyperlinkLinkStore::HashToString(const FXxHash128& Hash)
+{
+	return FString::Printf(TEXT("%016llx%016llx"), Hash.HashHigh, Hash.HashLow);
+}
+
+/*static*/bool FHyperlinkLinkStore::TryParseHash(const FStringView InHash, FXxHash128& OutHash)
+{
+	bool bResult{ InHash.Len() == HashLength };
+	
+	uint64 Words[2]{ 0, 0 };
+	for (int32 Idx{ 0 }; bResult && Idx < HashLength; ++Idx)
+	{
+		bResult = FChar::IsHexDigit(InHash[Idx]);
+		Words[Idx / 16] = (Words[Idx / 16] << 4) | FParse::HexDigit(InHash[Idx]);
+	}
+
+	if (bResult)
+	{
+		OutHash.HashHigh = Words[0];
+		OutHash.HashLow = Words[1];
+	}
+	
+	return bResult;
+}
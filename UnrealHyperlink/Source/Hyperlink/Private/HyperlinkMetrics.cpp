@@ -0,0 +1,208 @@
+﻿// Copyright (c) 2023-2024 Fergus Brown. Licensed under the MIT license. See "LICENSE" file for details.
+
+
+#include "HyperlinkMetrics.h"
+
+#include "HyperlinkSubsystem.h"
+#include "HyperlinkUtility.h"
+#include "Misc/StringBuilder.h"
+
+#if WITH_EDITOR
+#include "Engine/Engine.h"
+#endif //WITH_EDITOR
+
+#include <atomic>
+
+namespace FHyperlinkMetricsState
+{
+	/* Upper bounds of the execute time histogram buckets in seconds, +Inf is implicit */
+	static constexpr double BucketBounds[]{ 0.001, 0.0025, 0.005, 0.01, 0.025, 0.05, 0.1, 0.25, 0.5, 1.0, 2.5, 5.0, 10.0 };
+	static constexpr int32 NumBuckets{ UE_ARRAY_COUNT(BucketBounds) };
+	/* Quantiles are taken from the most recent execute times so they follow changes in performance */
+	static constexpr int32 MaxRecentSamples{ 1024 };
+	static constexpr double Quantiles[]{ 0.5, 0.95, 0.99 };
+
+	/* Indexed by EHyperlinkDecodeResult */
+	static constexpr const TCHAR* DecodeResultNames[]
+		{ TEXT("success"), TEXT("malformed"), TEXT("not_stored"), TEXT("unknown_definition"), TEXT("missing_asset") };
+	static constexpr int32 NumDecodeResults{ UE_ARRAY_COUNT(DecodeResultNames) };
+
+	static std::atomic<uint64> NumReceived{ 0 };
+	static std::atomic<uint64> DecodeResultCounts[NumDecodeResults]{};
+	static std::atomic<uint64> NumDropped{ 0 };
+	static std::atomic<uint64> NumCoalesced{ 0 };
+
+	struct FExecuteTimes
+	{
+		uint64 BucketCounts[NumBuckets]{};
+		uint64 Count{ 0 };
+		double Sum{ 0.0 };
+		TArray<double> RecentSamples{};
+		int32 NextSample{ 0 };
+	};
+
+	/* By definition identifier, game thread only */
+	static TSortedMap<FString, FExecuteTimes>& GetExecuteTimes()
+	{
+		static TSortedMap<FString, FExecuteTimes> ExecuteTimes{};
+		return ExecuteTimes;
+	}
+
+	static void WriteHeader(FStringBuilderBase& Builder, const TCHAR* const Name, const TCHAR* const Type,
+		const TCHAR* const Help)
+	{
+		Builder.Appendf(TEXT("# HELP %s %s\n# TYPE %s %s\n"), Name, Help, Name, Type);
+	}
+
+	/* @return the string escaped for use as a label value */
+	static FString EscapeLabel(const FString& InString)
+	{
+		return InString.Replace(TEXT("\\"), TEXT("\\\\")).Replace(TEXT("\""), TEXT("\\\""))
+			.Replace(TEXT("\n"), TEXT("\\n"));
+	}
+}
+
+/*static*/void FHyperlinkMetrics::RecordDecode(const EHyperlinkDecodeResult Result)
+{
+	using namespace FHyperlinkMetricsState;
+	
+	NumReceived.fetch_add(1, std::memory_order_relaxed);
+	const int32 ResultIndex{ static_cast<int32>(Result) };
+	if (ensure(ResultIndex < NumDecodeResults))
+	{
+		DecodeResultCounts[ResultIndex].fetch_add(1, std::memory_order_relaxed);
+	}
+}
+
+/*static*/void FHyperlinkMetrics::RecordDropped(const uint32 NumLinks)
+{
+	FHyperlinkMetricsState::NumDropped.fetch_add(NumLinks, std::memory_order_relaxed);
+}
+
+/*static*/void FHyperlinkMetrics::RecordCoalesced()
+{
+	FHyperlinkMetricsState::NumCoalesced.fetch_add(1, std::memory_order_relaxed);
+}
+
+/*static*/void FHyperlinkMetrics::RecordExecuted(const FString& Identifier, const double Seconds)
+{
+	using namespace FHyperlinkMetricsState;
+	check(IsInGameThread());
+	
+	FExecuteTimes& Times{ GetExecuteTimes().FindOrAdd(Identifier) };
+	for (int32 BucketIdx{ 0 }; BucketIdx < NumBuckets; ++BucketIdx)
+	{
+		if (Seconds <= BucketBounds[BucketIdx])
+		{
+			++Times.BucketCounts[BucketIdx];
+			break;
+		}
+	}
+	++Times.Count;
+	Times.Sum += Seconds;
+
+	if (Times.RecentSamples.Num() < MaxRecentSamples)
+	{
+		Times.RecentSamples.Add(Seconds);
+	}
+	else
+	{
+		Times.RecentSamples[Times.NextSample] = Seconds;
+		Times.NextSample = (Times.NextSample + 1) % MaxRecentSamples;
+	}
+}
+
+/*static*/FString FHyperlinkMetrics::ExportPrometheus()
+{
+	using namespace FHyperlinkMetricsState;
+	check(IsInGameThread());
+
+	TStringBuilder<4096> Builder{};
+
+	WriteHeader(Builder, TEXT("hyperlink_links_received_total"), TEXT("counter"),
+		TEXT("Links decoded from a URL, the clipboard or the console."));
+	Builder.Appendf(TEXT("hyperlink_links_received_total %llu\n"), NumReceived.load(std::memory_order_relaxed));
+
+	WriteHeader(Builder, TEXT("hyperlink_links_rejected_total"), TEXT("counter"),
+		TEXT("Links which were not executed, by reason."));
+	for (int32 ResultIdx{ 1 }; ResultIdx < NumDecodeResults; ++ResultIdx)
+	{
+		Builder.Appendf(TEXT("hyperlink_links_rejected_total{reason=\"%s\"} %llu\n"), DecodeResultNames[ResultIdx],
+			DecodeResultCounts[ResultIdx].load(std::memory_order_relaxed));
+	}
+	Builder.Appendf(TEXT("hyperlink_links_rejected_total{reason=\"dropped\"} %llu\n"),
+		NumDropped.load(std::memory_order_relaxed));
+
+	WriteHeader(Builder, TEXT("hyperlink_links_coalesced_total"), TEXT("counter"),
+		TEXT("Duplicate links skipped because they arrived in the same burst."));
+	Builder.Appendf(TEXT("hyperlink_links_coalesced_total %llu\n"), NumCoalesced.load(std::memory_order_relaxed));
+
+	WriteHeader(Builder, TEXT("hyperlink_links_executed_total"), TEXT("counter"),
+		TEXT("Links passed to their definition, by definition."));
+	for (const TPair<FString, FExecuteTimes>& Pair : GetExecuteTimes())
+	{
+		Builder.Appendf(TEXT("hyperlink_links_executed_total{definition=\"%s\"} %llu\n"), *EscapeLabel(Pair.Key),
+			Pair.Value.Count);
+	}
+
+	WriteHeader(Builder, TEXT("hyperlink_execute_seconds"), TEXT("histogram"),
+		TEXT("Time definitions take to execute a link, not including asynchronous loading."));
+	for (const TPair<FString, FExecuteTimes>& Pair : GetExecuteTimes())
+	{
+		const FString Label{ EscapeLabel(Pair.Key) };
+		uint64 CumulativeCount{ 0 };
+		for (int32 BucketIdx{ 0 }; BucketIdx < NumBuckets; ++BucketIdx)
+		{
+			CumulativeCount += Pair.Value.BucketCounts[BucketIdx];
+			Builder.Appendf(TEXT("hyperlink_execute_seconds_bucket{definition=\"%s\",le=\"%g\"} %llu\n"), *Label,
+				BucketBounds[BucketIdx], CumulativeCount);
+		}
+		Builder.Appendf(TEXT("hyperlink_execute_seconds_bucket{definition=\"%s\",le=\"+Inf\"} %llu\n"), *Label,
+			Pair.Value.Count);
+		Builder.Appendf(TEXT("hyperlink_execute_seconds_sum{definition=\"%s\"} %.9g\n"), *Label, Pair.Value.Sum);
+		Builder.Appendf(TEXT("hyperlink_execute_seconds_count{definition=\"%s\"} %llu\n"), *Label, Pair.Value.Count);
+	}
+
+	WriteHeader(Builder, TEXT("hyperlink_execute_quantile_seconds"), TEXT("gauge"),
+		TEXT("Quantiles of the most recent execute times, by definition."));
+	for (const TPair<FString, FExecuteTimes>& Pair : GetExecuteTimes())
+	{
+		TArray<double> SortedSamples{ Pair.Value.RecentSamples };
+		SortedSamples.Sort();
+		for (const double Quantile : Quantiles)
+		{
+			// Nearest rank
+			const int32 SampleIdx{ FMath::Clamp(FMath::CeilToInt(Quantile * SortedSamples.Num()) - 1, 0,
+				SortedSamples.Num() - 1) };
+			Builder.Appendf(TEXT("hyperlink_execute_quantile_seconds{definition=\"%s\",quantile=\"%g\"} %.9g\n"),
+				*EscapeLabel(Pair.Key), Quantile, SortedSamples[SampleIdx]);
+		}
+	}
+
+#if WITH_EDITOR
+	if (GEngine)
+	{
+		if (const UHyperlinkSubsystem* const Subsystem{ GEngine->GetEngineSubsystem<UHyperlinkSubsystem>() })
+		{
+			WriteHeader(Builder, TEXT("hyperlink_link_queue_depth"), TEXT("gauge"),
+				TEXT("Links waiting to be executed after the editor tick."));
+			Builder.Appendf(TEXT("hyperlink_link_queue_depth %d\n"), Subsystem->GetNumQueuedLinks());
+		}
+	}
+#endif //WITH_EDITOR
+
+	const FHyperlinkUtility::FLinkCacheStats CacheStats{ FHyperlinkUtility::GetLinkCacheStats() };
+	const uint64 NumLookups{ CacheStats.NumHits + CacheStats.NumMisses };
+	WriteHeader(Builder, TEXT("hyperlink_link_cache_lookups_total"), TEXT("counter"),
+		TEXT("Lookups of the cache of created links, by result."));
+	Builder.Appendf(TEXT("hyperlink_link_cache_lookups_total{result=\"hit\"} %llu\n"), CacheStats.NumHits);
+	Builder.Appendf(TEXT("hyperlink_link_cache_lookups_total{result=\"miss\"} %llu\n"), CacheStats.NumMisses);
+	WriteHeader(Builder, TEXT("hyperlink_link_cache_hit_ratio"), TEXT("gauge"),
+		TEXT("Fraction of link cache lookups which were hits."));
+	Builder.Appendf(TEXT("hyperlink_link_cache_hit_ratio %g\n"),
+		NumLookups > 0 ? static_cast<double>(CacheStats.NumHits) / NumLookups : 0.0);
+	WriteHeader(Builder, TEXT("hyperlink_link_cache_entries"), TEXT("gauge"), TEXT("Links in the link cache."));
+	Builder.Appendf(TEXT("hyperlink_link_cache_entries %d\n"), CacheStats.NumEntries);
+
+	return FString(Builder.ToView());
+}
@@ -0,0 +1,362 @@
+﻿// Copyright (c) 2023-2024 Fergus Brown. Licensed under the MIT license. See "LICENSE" file for details.
+
+
+#include "HyperlinkPayloadCodec.h"
+
+#include "HyperlinkStats.h"
+#include "JsonObjectConverter.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+namespace FHyperlinkPayloadCodecHelpers
+{
+	using FJsonWriter = TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>;
+	using FJsonReader = TJsonReader<TCHAR>;
+
+	static bool IsSupportedStruct(const UScriptStruct* Struct);
+
+	/* Structs with ExportTextItem are written as strings by FJsonObjectConverter, e.g. FGuid */
+	static bool HasExportTextItem(const UScriptStruct* const Struct)
+	{
+		const UScriptStruct::ICppStructOps* const StructOps{ Struct->GetCppStructOps() };
+		return StructOps && StructOps->HasExportTextItem();
+	}
+
+	static bool IsSupportedProperty(const FProperty* const Property)
+	{
+		bool bResult{ false };
+
+		if (Property->ArrayDim == 1)
+		{
+			if (const FStructProperty* const StructProperty{ CastField<FStructProperty>(Property) })
+			{
+				bResult = HasExportTextItem(StructProperty->Struct) || IsSupportedStruct(StructProperty->Struct);
+			}
+			else if (const FArrayProperty* const ArrayProperty{ CastField<FArrayProperty>(Property) })
+			{
+				bResult = IsSupportedProperty(ArrayProperty->Inner);
+			}
+			else
+			{
+				bResult = Property->IsA<FBoolProperty>() || Property->IsA<FEnumProperty>()
+					|| Property->IsA<FNumericProperty>() || Property->IsA<FStrProperty>()
+					|| Property->IsA<FNameProperty>() || Property->IsA<FTextProperty>();
+			}
+		}
+
+		return bResult;
+	}
+
+	static bool IsSupportedStruct(const UScriptStruct* const Struct)
+	{
+		bool bResult{ true };
+		for (TFieldIterator<FProperty> It{ Struct }; It && bResult; ++It)
+		{
+			bResult = IsSupportedProperty(*It);
+		}
+		return bResult;
+	}
+
+	static const FProperty* FindProperty(const UScriptStruct* const Struct, const FString& Name)
+	{
+		// FName comparison is case insensitive, matching FJsonObjectConverter::StandardizeCase. Finding the name rather
+		// than adding it means unknown keys don't grow the name table, and NAME_None can't match any property
+		const FProperty* Ret{ nullptr };
+		const FName Key{ *Name, FNAME_Find };
+		for (TFieldIterator<FProperty> It{ Struct }; Key != NAME_None && It; ++It)
+		{
+			if (It->GetFName() == Key)
+			{
+				Ret = *It;
+				break;
+			}
+		}
+		return Ret;
+	}
+
+	static int64 FindEnumValue(const UEnum* const Enum, const FString& Name)
+	{
+		int64 Value{ Enum->GetValueByNameString(Name) };
+		for (int32 Idx{ 0 }; Value == INDEX_NONE && Idx < Enum->NumEnums(); ++Idx)
+		{
+			if (Enum->GetAuthoredNameStringByIndex(Idx).Equals(Name, ESearchCase::IgnoreCase))
+			{
+				Value = Enum->GetValueByIndex(Idx);
+			}
+		}
+		return Value;
+	}
+
+	static void WriteStruct(FJsonWriter& Writer, const UScriptStruct* Struct, const void* InStruct);
+
+	static void WriteValue(FJsonWriter& Writer, const FProperty* const Property, const void* const Value)
+	{
+		if (const FBoolProperty* const BoolProperty{ CastField<FBoolProperty>(Property) })
+		{
+			Writer.WriteValue(BoolProperty->GetPropertyValue(Value));
+		}
+		else if (const FEnumProperty* const EnumProperty{ CastField<FEnumProperty>(Property) })
+		{
+			Writer.WriteValue(EnumProperty->GetEnum()->GetAuthoredNameStringByValue(
+				EnumProperty->GetUnderlyingProperty()->GetSignedIntPropertyValue(Value)));
+		}
+		else if (const FNumericProperty* const NumericProperty{ CastField<FNumericProperty>(Property) })
+		{
+			if (const UEnum* const Enum{ NumericProperty->GetIntPropertyEnum() })
+			{
+				Writer.WriteValue(
+					Enum->GetAuthoredNameStringByValue(NumericProperty->GetSignedIntPropertyValue(Value)));
+			}
+			else if (NumericProperty->IsFloatingPoint())
+			{
+				Writer.WriteValue(NumericProperty->GetFloatingPointPropertyValue(Value));
+			}
+			else
+			{
+				Writer.WriteValue(NumericProperty->GetSignedIntPropertyValue(Value));
+			}
+		}
+		else if (const FStrProperty* const StrProperty{ CastField<FStrProperty>(Property) })
+		{
+			Writer.WriteValue(StrProperty->GetPropertyValue(Value));
+		}
+		else if (const FNameProperty* const NameProperty{ CastField<FNameProperty>(Property) })
+		{
+			Writer.WriteValue(NameProperty->GetPropertyValue(Value).ToString());
+		}
+		else if (const FTextProperty* const TextProperty{ CastField<FTextProperty>(Property) })
+		{
+			Writer.WriteValue(TextProperty->GetPropertyValue(Value).ToString());
+		}
+		else if (const FStructProperty* const StructProperty{ CastField<FStructProperty>(Property) })
+		{
+			if (HasExportTextItem(StructProperty->Struct))
+			{
+				FString ExportedText{};
+				StructProperty->Struct->GetCppStructOps()->ExportTextItem(ExportedText, Value, nullptr, nullptr,
+					PPF_None, nullptr);
+				Writer.WriteValue(ExportedText);
+			}
+			else
+			{
+				WriteStruct(Writer, StructProperty->Struct, Value);
+			}
+		}
+		else if (const FArrayProperty* const ArrayProperty{ CastField<FArrayProperty>(Property) })
+		{
+			FScriptArrayHelper ArrayHelper{ ArrayProperty, Value };
+			Writer.WriteArrayStart();
+			for (int32 Idx{ 0 }; Idx < ArrayHelper.Num(); ++Idx)
+			{
+				WriteValue(Writer, ArrayProperty->Inner, ArrayHelper.GetRawPtr(Idx));
+			}
+			Writer.WriteArrayEnd();
+		}
+	}
+
+	static void WriteStruct(FJsonWriter& Writer, const UScriptStruct* const Struct, const void* const InStruct)
+	{
+		Writer.WriteObjectStart();
+		for (TFieldIterator<FProperty> It{ Struct }; It; ++It)
+		{
+			Writer.WriteIdentifierPrefix(FJsonObjectConverter::StandardizeCase(It->GetName()));
+			WriteValue(Writer, *It, It->ContainerPtrToValuePtr<void>(InStruct));
+		}
+		Writer.WriteObjectEnd();
+	}
+
+	static bool ReadStruct(FJsonReader& Reader, const UScriptStruct* Struct, void* OutStruct, bool bStrict);
+
+	/* Read the value the reader has just read the notation of */
+	static bool ReadValue(FJsonReader& Reader, const EJsonNotation Notation, const FProperty* const Property,
+		void* const Value, const bool bStrict)
+	{
+		bool bResult{ false };
+
+		const FNumericProperty* const NumericProperty{ CastField<FNumericProperty>(Property) };
+		switch (Notation)
+		{
+		case EJsonNotation::Boolean:
+			if (const FBoolProperty* const BoolProperty{ CastField<FBoolProperty>(Property) })
+			{
+				BoolProperty->SetPropertyValue(Value, Reader.GetValueAsBoolean());
+				bResult = true;
+			}
+			break;
+		case EJsonNotation::Number:
+			if (NumericProperty && NumericProperty->IsFloatingPoint())
+			{
+				NumericProperty->SetFloatingPointPropertyValue(Value, Reader.GetValueAsNumber());
+				bResult = true;
+			}
+			else if (NumericProperty && NumericProperty->IsInteger())
+			{
+				NumericProperty->SetIntPropertyValue(Value, static_cast<int64>(Reader.GetValueAsNumber()));
+				bResult = true;
+			}
+			break;
+		case EJsonNotation::String:
+			{
+				const FString& String{ Reader.GetValueAsString() };
+				const FEnumProperty* const EnumProperty{ CastField<FEnumProperty>(Property) };
+				const UEnum* const Enum{ EnumProperty ? EnumProperty->GetEnum()
+					: NumericProperty ? NumericProperty->GetIntPropertyEnum() : nullptr };
+
+				if (const FStrProperty* const StrProperty{ CastField<FStrProperty>(Property) })
+				{
+					StrProperty->SetPropertyValue(Value, String);
+					bResult = true;
+				}
+				else if (const FNameProperty* const NameProperty{ CastField<FNameProperty>(Property) })
+				{
+					NameProperty->SetPropertyValue(Value, FName(String));
+					bResult = true;
+				}
+				else if (const FTextProperty* const TextProperty{ CastField<FTextProperty>(Property) })
+				{
+					TextProperty->SetPropertyValue(Value, FText::FromString(String));
+					bResult = true;
+				}
+				else if (Enum)
+				{
+					const int64 EnumValue{ FindEnumValue(Enum, String) };
+					if (EnumValue != INDEX_NONE)
+					{
+						const FNumericProperty* const UnderlyingProperty
+							{ EnumProperty ? EnumProperty->GetUnderlyingProperty() : NumericProperty };
+						UnderlyingProperty->SetIntPropertyValue(Value, EnumValue);
+						bResult = true;
+					}
+				}
+				else
+				{
+					// Structs with ImportTextItem e.g. FGuid and numbers written as strings
+					bResult = Property->ImportText_Direct(*String, Value, nullptr, PPF_None) != nullptr;
+				}
+			}
+			break;
+		case EJsonNotation::ObjectStart:
+			if (const FStructProperty* const StructProperty{ CastField<FStructProperty>(Property) })
+			{
+				bResult = ReadStruct(Reader, StructProperty->Struct, Value, bStrict);
+			}
+			break;
+		case EJsonNotation::ArrayStart:
+			if (const FArrayProperty* const ArrayProperty{ CastField<FArrayProperty>(Property) })
+			{
+				FScriptArrayHelper ArrayHelper{ ArrayProperty, Value };
+				ArrayHelper.EmptyValues();
+
+				bResult = true;
+				EJsonNotation ElementNotation{ EJsonNotation::Error };
+				while (bResult && Reader.ReadNext(ElementNotation) && ElementNotation != EJsonNotation::ArrayEnd)
+				{
+					const int32 Idx{ ArrayHelper.AddValue() };
+					bResult = ReadValue(Reader, ElementNotation, ArrayProperty->Inner, ArrayHelper.GetRawPtr(Idx),
+						bStrict);
+				}
+				bResult &= ElementNotation == EJsonNotation::ArrayEnd;
+			}
+			break;
+		case EJsonNotation::Null:
+			// Leave the default value
+			bResult = true;
+			break;
+		default:
+			break;
+		}
+
+		return bResult;
+	}
+
+	/* Read the members of an object after the reader has read its ObjectStart */
+	static bool ReadStruct(FJsonReader& Reader, const UScriptStruct* const Struct, void* const OutStruct,
+		const bool bStrict)
+	{
+		bool bResult{ true };
+		int32 NumPropertiesRead{ 0 };
+
+		EJsonNotation Notation{ EJsonNotation::Error };
+		while (bResult && Reader.ReadNext(Notation) && Notation != EJsonNotation::ObjectEnd)
+		{
+			if (const FProperty* const Property{ FindProperty(Struct, Reader.GetIdentifier()) })
+			{
+				bResult = ReadValue(Reader, Notation, Property, Property->ContainerPtrToValuePtr<void>(OutStruct),
+					bStrict);
+				++NumPropertiesRead;
+			}
+			else if (Notation == EJsonNotation::ObjectStart)
+			{
+				bResult = Reader.SkipObject();
+			}
+			else if (Notation == EJsonNotation::ArrayStart)
+			{
+				bResult = Reader.SkipArray();
+			}
+		}
+		bResult &= Notation == EJsonNotation::ObjectEnd;
+
+		if (bResult && bStrict)
+		{
+			int32 NumProperties{ 0 };
+			for (TFieldIterator<FProperty> It{ Struct }; It; ++It)
+			{
+				++NumProperties;
+			}
+			bResult = NumPropertiesRead >= NumProperties;
+		}
+
+		return bResult;
+	}
+}
+
+/*static*/bool FHyperlinkPayloadCodec::WriteStruct(const UScriptStruct* const Struct, const void* const InStruct,
+	FString& OutPayloadString)
+{
+	HYPERLINK_SCOPE_CYCLE_COUNTER(STAT_HyperlinkJsonConversion);
+	
+	bool bResult{ false };
+	OutPayloadString.Reset();
+
+	if (FHyperlinkPayloadCodecHelpers::IsSupportedStruct(Struct))
+	{
+		const TSharedRef<FHyperlinkPayloadCodecHelpers::FJsonWriter> JsonWriter
+			{ TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&OutPayloadString) };
+		FHyperlinkPayloadCodecHelpers::WriteStruct(*JsonWriter, Struct, InStruct);
+		bResult = JsonWriter->Close();
+	}
+	else
+	{
+		bResult = FJsonObjectConverter::UStructToJsonObjectString(Struct, InStruct, OutPayloadString, 0, 0, 0,
+			nullptr, false);
+	}
+
+	return bResult;
+}
+
+/*static*/bool FHyperlinkPayloadCodec::ReadStruct(const FStringView InPayloadString, const UScriptStruct* const Struct,
+	void* const OutStruct, const bool bStrict)
+{
+	HYPERLINK_SCOPE_CYCLE_COUNTER(STAT_HyperlinkJsonConversion);
+	
+	bool bResult{ false };
+
+	const TSharedRef<FHyperlinkPayloadCodecHelpers::FJsonReader> JsonReader
+		{ TJsonReaderFactory<TCHAR>::CreateFromView(InPayloadString) };
+	if (FHyperlinkPayloadCodecHelpers::IsSupportedStruct(Struct))
+	{
+		EJsonNotation Notation{ EJsonNotation::Error };
+		bResult = JsonReader->ReadNext(Notation) && Notation == EJsonNotation::ObjectStart
+			&& FHyperlinkPayloadCodecHelpers::ReadStruct(*JsonReader, Struct, OutStruct, bStrict);
+	}
+	else
+	{
+		TSharedPtr<FJsonObject> JsonObject{};
+		bResult = FJsonSerializer::Deserialize(JsonReader, JsonObject) && JsonObject.IsValid()
+			&& FJsonObjectConverter::JsonObjectToUStruct(JsonObject.ToSharedRef(), Struct, OutStruct, 0, 0, bStrict);
+	}
+
+	return bResult;
+}
@@ -10,7 +10,11 @@
 #include "EditorUtilityBlueprint.h"
 #include "HyperlinkClassEntry.h"
 #include "HyperlinkDefinition.h"
+#include "HyperlinkStartupProfiler.h"
 #include "HyperlinkSubsystem.h"
+#include "LogHyperlink.h"
+#include "Tests/HyperlinkTestDefinition.h"
+#include "UObject/UObjectHash.h"
 #endif //WITH_EDITOR
 
 
@@ -48,7 +52,31 @@ void UHyperlinkSettings::PostEditChangeProperty(FPropertyChangedEvent& PropertyC
 {
 	Super::PostEditChangeProperty(PropertyChangedEvent);
 		
-	GEngine->GetEngineSubsystem<UHyperlinkSubsystem>()->RefreshDefinitions();
+	const FName PropertyName{ PropertyChangedEvent.GetMemberPropertyName() };
+	if (PropertyName == GET_MEMBER_NAME_CHECKED(UHyperlinkSettings, ProjectIdentifier) ||
+		PropertyName == GET_MEMBER_NAME_CHECKED(UHyperlinkSettings, LocalServerPort))
+	{
+		FHyperlinkUtility::ResetLinkBaseAddress();
+	}
+	
+	UHyperlinkSubsystem* const Subsystem{ GEngine->GetEngineSubsystem<UHyperlinkSubsystem>() };
+	if (PropertyName == GET_MEMBER_NAME_CHECKED(UHyperlinkSettings, RegisteredDefinitions))
+	{
+		// Only the edited entries are updated, the other definitions keep their commands and menu extensions
+		Subsystem->RefreshDefinitions();
+	}
+	else
+	{
+		// Most settings affect the links generated
+		FHyperlinkUtility::ResetLinkCache();
+	}
+	
+	if (PropertyName == GET_MEMBER_NAME_CHECKED(UHyperlinkSettings, bUseLinkStore) ||
+		PropertyName == GET_MEMBER_NAME_CHECKED(UHyperlinkSettings, LinkStoreDirectory) ||
+		PropertyName == GET_MEMBER_NAME_CHECKED(UHyperlinkSettings, LinkStoreTimeToLiveDays))
+	{
+		Subsystem->ResetLinkStore();
+	}
 }
 
 #endif //WITH_EDITOR
@@ -58,18 +86,44 @@ TConstArrayView<FHyperlinkClassEntry> UHyperlinkSettings::GetRegisteredDefinitio
 	return TConstArrayView<FHyperlinkClassEntry>(RegisteredDefinitions);
 }
 
+FString UHyperlinkSettings::GetLinkStoreDirectory() const
+{
+	return LinkStoreDirectory.Path.IsEmpty()
+		? FPaths::ProjectSavedDir() / TEXT("Hyperlink")
+		: FPaths::ConvertRelativePathToFull(FPaths::ProjectDir(), LinkStoreDirectory.Path);
+}
+
+FTimespan UHyperlinkSettings::GetLinkStoreTimeToLive() const
+{
+	return FTimespan::FromDays(LinkStoreTimeToLiveDays);
+}
+
 #if WITH_EDITOR
 
 void UHyperlinkSettings::OnAssetRegistryReady()
 {
-	RegisterBlueprintClasses();
+	{
+		const FHyperlinkStartupProfiler::FScope ProfilerScope{ TEXT("UHyperlinkSettings::OnAssetRegistryReady") };
+		const double StartTime{ FPlatformTime::Seconds() };
+		RegisterBlueprintClasses();
+		UE_LOG(LogHyperlink, Log, TEXT("Registered Blueprint definitions in %.2fms"),
+			(FPlatformTime::Seconds() - StartTime) * 1000.0);
+	}
+	
 	PostRegister();
 	IAssetRegistry::GetChecked().OnInMemoryAssetCreated().AddUObject(this, &UHyperlinkSettings::OnAssetCreated);
 }
 
 void UHyperlinkSettings::OnPythonInitialised()
 {
-	RegisterInMemoryClasses();
+	{
+		const FHyperlinkStartupProfiler::FScope ProfilerScope{ TEXT("UHyperlinkSettings::OnPythonInitialised") };
+		const double StartTime{ FPlatformTime::Seconds() };
+		RegisterInMemoryClasses();
+		UE_LOG(LogHyperlink, Log, TEXT("Registered C++ and Python definitions in %.2fms"),
+			(FPlatformTime::Seconds() - StartTime) * 1000.0);
+	}
+	
 	PostRegister();
 }
 
@@ -77,8 +131,10 @@ void UHyperlinkSettings::OnAssetCreated(UObject* InObject)
 {
 	if (const UEditorUtilityBlueprint* const BP{ Cast<UEditorUtilityBlueprint>(InObject) })
 	{
+		// Derive the identifier from the asset data, as for Blueprints found in the asset registry
 		if (BP->ParentClass->IsChildOf<UHyperlinkDefinition>() &&
-			RegisterDefinitionClass(BP->GeneratedClass))
+			RegisterDefinitionClass(TSoftClassPtr<UHyperlinkDefinition>(BP->GeneratedClass.Get()),
+				FHyperlinkUtility::CreateBlueprintClassDisplayString(FAssetData(BP))))
 		{
 			PostRegister();
 		}
@@ -89,12 +145,17 @@ bool UHyperlinkSettings::RegisterInMemoryClasses()
 {
 	bool bResult{ false };
 	
-	for(TObjectIterator<UClass> It; It; ++It)
+	// Only visit the definition classes in the class tree rather than every class in memory
+	TArray<UClass*> DerivedClasses{};
+	GetDerivedClasses(UHyperlinkDefinition::StaticClass(), DerivedClasses);
+	for (UClass* const Class : DerivedClasses)
 	{
-		if(It->IsChildOf(UHyperlinkDefinition::StaticClass()) &&
-			!It->HasAnyClassFlags(CLASS_Abstract | CLASS_CompiledFromBlueprint))
+		// Definitions used by automation tests aren't listed in the project's settings
+		if (!Class->HasAnyClassFlags(CLASS_Abstract | CLASS_CompiledFromBlueprint)
+			&& !Class->IsChildOf<UHyperlinkTestDefinition>())
 		{
-			bResult = RegisterDefinitionClass(*It);
+			bResult |= RegisterDefinitionClass(TSoftClassPtr<UHyperlinkDefinition>(Class),
+				FHyperlinkUtility::CreateClassDisplayString(Class));
 		}
 	}
 
@@ -134,16 +195,16 @@ bool UHyperlinkSettings::RegisterBlueprintClasses()
 			const FTopLevelAssetPath ClassObjectPath{
 				FPackageName::ExportTextPathToObjectPath(ParentClassPath.GetValue()) };
 			
-			if (DerivedClassPaths.Contains(ClassObjectPath))
+			const FAssetTagValueRef GeneratedClassPath{
+				Asset.TagsAndValues.FindTag(FBlueprintTags::GeneratedClassPath) };
+			
+			// Register the class by path, it's loaded by the subsystem after startup or when first used
+			if (DerivedClassPaths.Contains(ClassObjectPath) && GeneratedClassPath.IsSet())
 			{
-				const FAssetTagValueRef GeneratedClassPath{
-					Asset.TagsAndValues.FindTag(FBlueprintTags::GeneratedClassPath) };
-				
-				const TSoftObjectPtr<UClass> SoftObjectPtr(GeneratedClassPath.GetValue());
-				if (UClass* const Class{ SoftObjectPtr.LoadSynchronous() })
-				{
-					bResult = RegisterDefinitionClass(Class);
-				}
+				const TSoftClassPtr<UHyperlinkDefinition> Class{ FSoftObjectPath(
+					FPackageName::ExportTextPathToObjectPath(GeneratedClassPath.GetValue())) };
+				bResult |= RegisterDefinitionClass(Class,
+					FHyperlinkUtility::CreateBlueprintClassDisplayString(Asset));
 			}
 		}
 	}
@@ -152,18 +213,20 @@ bool UHyperlinkSettings::RegisterBlueprintClasses()
 	return bResult;
 }
 
-bool UHyperlinkSettings::RegisterDefinitionClass(UClass* const Class)
+bool UHyperlinkSettings::RegisterDefinitionClass(const TSoftClassPtr<UHyperlinkDefinition>& Class,
+	FString Identifier)
 {
 	bool bResult{ false };
 	
-	if (!RegisteredDefinitions.FindByPredicate([=](const FHyperlinkClassEntry& Entry)
+	if (!RegisteredDefinitions.FindByPredicate([&Class](const FHyperlinkClassEntry& Entry)
 		{ return Entry.Class == Class; }))
 	{
 		FHyperlinkClassEntry NewEntry{};
 		NewEntry.Class = Class;
-		NewEntry.Identifier = FHyperlinkUtility::CreateClassDisplayString(Class);
+		NewEntry.Identifier = MoveTemp(Identifier);
 		
 		RegisteredDefinitions.Emplace(MoveTemp(NewEntry));
+		bRegisteredDefinitionsChanged = true;
 		bResult = true;
 	}
 
@@ -172,23 +235,46 @@ bool UHyperlinkSettings::RegisterDefinitionClass(UClass* const Class)
 
 void UHyperlinkSettings::PostRegister()
 {
-	// With class registration complete all classes in RegisteredDefinitions should be loaded and we can perform some
-	// cleanup and sorting
+	// With class registration complete all C++ and Python classes in RegisteredDefinitions should be loaded and we can
+	// perform some cleanup and sorting. Blueprint classes aren't loaded, so only their packages are checked
 	if (bBlueprintClassesRegistered && bInMemoryClassesRegistered)
 	{
-		// Any nullptr can be removed as invalid classes
-		RegisteredDefinitions.RemoveAll([](const FHyperlinkClassEntry& Entry)
-			{ return Entry.Class.LoadSynchronous() == nullptr; });
+		TOptional<FHyperlinkStartupProfiler::FScope> ProfilerScope{};
+		ProfilerScope.Emplace(TEXT("UHyperlinkSettings::PostRegister"));
+		const double StartTime{ FPlatformTime::Seconds() };
+		
+		// Entries whose class no longer exists can be removed
+		bRegisteredDefinitionsChanged |= RegisteredDefinitions.RemoveAll([](const FHyperlinkClassEntry& Entry)
+			{
+				return Entry.Class.IsNull() || (Entry.Class.Get() == nullptr
+					&& !FPackageName::DoesPackageExist(Entry.Class.ToSoftObjectPath().GetLongPackageName()));
+			}) > 0;
 	
 		// Sort registered definitions so they appear in alphabetical order
+		TArray<FHyperlinkClassEntry> UnsortedDefinitions{ RegisteredDefinitions };
 		RegisteredDefinitions.Sort([](const FHyperlinkClassEntry& Lhs, const FHyperlinkClassEntry& Rhs)
 			{ return Lhs.Class.GetAssetName() < Rhs.Class.GetAssetName(); });
+		for (int32 Idx{ 0 }; Idx < RegisteredDefinitions.Num() && !bRegisteredDefinitionsChanged; ++Idx)
+		{
+			bRegisteredDefinitionsChanged = RegisteredDefinitions[Idx].Class != UnsortedDefinitions[Idx].Class;
+		}
 
-		// Update default config
-		SaveConfig(CPF_Config, *GetDefaultConfigFilename());
+		// Update default config, only when the entries changed to avoid touching the file on every startup
+		if (bRegisteredDefinitionsChanged)
+		{
+			SaveConfig(CPF_Config, *GetDefaultConfigFilename());
+			bRegisteredDefinitionsChanged = false;
+		}
 
 		// Ensure subsystem is up to date
 		GEngine->GetEngineSubsystem<UHyperlinkSubsystem>()->RefreshDefinitions();
+		
+		UE_LOG(LogHyperlink, Log, TEXT("Initialized %d definitions in %.2fms"), RegisteredDefinitions.Num(),
+			(FPlatformTime::Seconds() - StartTime) * 1000.0);
+		
+		// Startup is complete, save the report for comparison between builds
+		ProfilerScope.Reset();
+		FHyperlinkStartupProfiler::WriteReport();
 	}
 }
 #endif //WITH_EDITOR
@@ -0,0 +1,116 @@
+﻿// Copyright (c) 2023-2024 Fergus Brown. Licensed under the MIT license. See "LICENSE" file for details.
+
+
+#include "HyperlinkStartupProfiler.h"
+
+#include "HAL/LowLevelMemTracker.h"
+#include "HyperlinkStats.h"
+#include "LogHyperlink.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/JsonSerializer.h"
+
+namespace FHyperlinkStartupProfilerState
+{
+	static TMap<FString, FHyperlinkStartupProfiler::FEntry>& GetEntries()
+	{
+		static TMap<FString, FHyperlinkStartupProfiler::FEntry> Entries{};
+		return Entries;
+	}
+
+	/* @return memory allocated under the Hyperlink LLM tag, 0 unless the editor was started with -llm */
+	static int64 GetUsedMemory()
+	{
+		int64 Ret{ 0 };
+#if ENABLE_LOW_LEVEL_MEM_TRACKER
+		if (FLowLevelMemTracker::IsEnabled())
+		{
+			// Tag totals are only gathered once a frame, so gather them now to include this scope's allocations
+			FLowLevelMemTracker& Tracker{ FLowLevelMemTracker::Get() };
+			Tracker.UpdateStatsPerFrame();
+			Ret = Tracker.GetTagAmountForTracker(ELLMTracker::Default, FName(TEXT("Hyperlink")), ELLMTagSet::None);
+		}
+#endif //ENABLE_LOW_LEVEL_MEM_TRACKER
+		return Ret;
+	}
+}
+
+// NOLINTNEXTLINE(performance-unnecessary-value-param) : moved into the member
+FHyperlinkStartupProfiler::FScope::FScope(FString InName)
+	: Name{ MoveTemp(InName) }
+	, StartTime{ FPlatformTime::Seconds() }
+	, StartMemory{ FHyperlinkStartupProfilerState::GetUsedMemory() }
+{
+}
+
+FHyperlinkStartupProfiler::FScope::~FScope()
+{
+	Record(Name, FPlatformTime::Seconds() - StartTime, FHyperlinkStartupProfilerState::GetUsedMemory() - StartMemory);
+}
+
+/*static*/void FHyperlinkStartupProfiler::Record(const FString& Name, const double Seconds, const int64 MemoryBytes)
+{
+	check(IsInGameThread());
+	
+	FEntry& Entry{ FHyperlinkStartupProfilerState::GetEntries().FindOrAdd(Name) };
+	Entry.Name = Name;
+	++Entry.Count;
+	Entry.Seconds += Seconds;
+	Entry.MemoryBytes += MemoryBytes;
+}
+
+/*static*/TArray<FHyperlinkStartupProfiler::FEntry> FHyperlinkStartupProfiler::GetEntries()
+{
+	TArray<FEntry> Entries{};
+	FHyperlinkStartupProfilerState::GetEntries().GenerateValueArray(Entries);
+	Entries.Sort([](const FEntry& Lhs, const FEntry& Rhs){ return Lhs.Seconds > Rhs.Seconds; });
+	return Entries;
+}
+
+/*static*/void FHyperlinkStartupProfiler::PrintReport()
+{
+	const TArray<FEntry> Entries{ GetEntries() };
+	
+	double TotalSeconds{ 0.0 };
+	FString Report{ FString::Printf(TEXT("%-64s %6s %10s %12s\n"), TEXT("Scope"), TEXT("Count"), TEXT("Time (ms)"),
+		TEXT("Memory (KB)")) };
+	for (const FEntry& Entry : Entries)
+	{
+		Report.Append(FString::Printf(TEXT("%-64s %6d %10.2f %12.1f\n"), *Entry.Name, Entry.Count,
+			Entry.Seconds * 1000.0, Entry.MemoryBytes / 1024.0));
+		TotalSeconds += Entry.Seconds;
+	}
+
+	// Scopes can be nested so the total is an upper bound
+	UE_LOG(LogHyperlink, Display, TEXT("Hyperlink startup report (%d scopes, at most %.2fms):\n%s"), Entries.Num(),
+		TotalSeconds * 1000.0, *Report);
+}
+
+/*static*/bool FHyperlinkStartupProfiler::WriteReport()
+{
+	FString JsonString{};
+	const TSharedRef<TJsonWriter<>> JsonWriter{ TJsonWriterFactory<>::Create(&JsonString) };
+	JsonWriter->WriteObjectStart();
+	JsonWriter->WriteArrayStart(TEXT("Scopes"));
+	for (const FEntry& Entry : GetEntries())
+	{
+		JsonWriter->WriteObjectStart();
+		JsonWriter->WriteValue(TEXT("Name"), Entry.Name);
+		JsonWriter->WriteValue(TEXT("Count"), Entry.Count);
+		JsonWriter->WriteValue(TEXT("Milliseconds"), Entry.Seconds * 1000.0);
+		JsonWriter->WriteValue(TEXT("MemoryBytes"), Entry.MemoryBytes);
+		JsonWriter->WriteObjectEnd();
+	}
+	JsonWriter->WriteArrayEnd();
+	JsonWriter->WriteObjectEnd();
+	JsonWriter->Close();
+
+	const FString ReportPath{ GetReportPath() };
+	const bool bResult{ FFileHelper::SaveStringToFile(JsonString, *ReportPath) };
+	UE_CLOG(!bResult, LogHyperlink, Warning, TEXT("Could not write startup report to %s"), *ReportPath);
+	return bResult;
+}
+
+/*static*/FString FHyperlinkStartupProfiler::GetReportPath()
+{
+	return FPaths::ProjectSavedDir() / TEXT("Hyperlink") / TEXT("startup.json");
+}
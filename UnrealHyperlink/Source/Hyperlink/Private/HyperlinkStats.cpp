@@ -0,0 +1,26 @@
+﻿// Copyright (c) 2023-2024 Fergus Brown. Licensed under the MIT license. See "LICENSE" file for details.
+
+
+#include "HyperlinkStats.h"
+
+UE_TRACE_CHANNEL_DEFINE(HyperlinkChannel);
+
+DEFINE_STAT(STAT_HyperlinkDecodeLink);
+DEFINE_STAT(STAT_HyperlinkUrlDecode);
+DEFINE_STAT(STAT_HyperlinkExtractPayload);
+DEFINE_STAT(STAT_HyperlinkJsonConversion);
+DEFINE_STAT(STAT_HyperlinkDispatch);
+DEFINE_STAT(STAT_HyperlinkPackageLoad);
+DEFINE_STAT(STAT_HyperlinkOpenEditor);
+DEFINE_STAT(STAT_HyperlinkMoveViewport);
+DEFINE_STAT(STAT_HyperlinkCreateLink);
+
+DEFINE_STAT(STAT_HyperlinkLinksQueued);
+DEFINE_STAT(STAT_HyperlinkLinksDropped);
+DEFINE_STAT(STAT_HyperlinkLinksCoalesced);
+DEFINE_STAT(STAT_HyperlinkLinksExecuted);
+
+DECLARE_LLM_MEMORY_STAT(TEXT("Hyperlink"), STAT_HyperlinkLLM, STATGROUP_LLMFULL);
+DECLARE_LLM_MEMORY_STAT(TEXT("Hyperlink"), STAT_HyperlinkSummaryLLM, STATGROUP_LLM);
+LLM_DEFINE_TAG(Hyperlink, NAME_None, NAME_None, GET_STATFNAME(STAT_HyperlinkLLM),
+	GET_STATFNAME(STAT_HyperlinkSummaryLLM));
@@ -5,20 +5,75 @@
 
 #include "HyperlinkClassEntry.h"
 #include "HyperlinkDefinition.h"
+#include "HyperlinkMetrics.h"
 #include "HyperlinkSettings.h"
+#include "HyperlinkStartupProfiler.h"
+#include "HyperlinkStats.h"
+#include "HyperlinkUtility.h"
 #include "LogHyperlink.h"
 
 #if WITH_EDITOR
-#include "Internationalization/Regex.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Editor.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
 #include "HyperlinkExecutePayload.h"
-#include "HyperlinkPythonBridge.h"
+#include "HyperlinkFormat.h"
 #include "Interfaces/IMainFrameModule.h"
-#include "HyperlinkUtility.h"
-#include "JsonObjectConverter.h"
+#include "Misc/PackageName.h"
+#include "Misc/StringBuilder.h"
+#include "ToolMenus.h"
+#include "UObject/GarbageCollection.h"
+
+namespace FHyperlinkInboxConstants
+{
+	/* Links which can be waiting to execute before new links are dropped */
+	static constexpr int32 Capacity{ 256 };
+
+	/* Time spent executing queued links per frame. At least one link is executed each frame */
+	static constexpr double FrameBudgetSeconds{ 0.008 };
+
+	/* Identical links executed within this long of each other are treated as one burst and only executed once */
+	static constexpr double CoalesceWindowSeconds{ 1.0 };
+
+	/* Throttling is restored after this long even if a link's asynchronous work hasn't finished, e.g. a stalled load */
+	static constexpr double MaxUnthrottledSeconds{ 30.0 };
+}
+
+namespace FHyperlinkSubsystemHelpers
+{
+	/**
+	 * @brief Check a package exists without touching the disk. Thread safe
+	 * @return true if the asset registry knows of the package, or it has been created but not saved yet
+	 */
+	static bool DoesPackageExist(const FName PackageName)
+	{
+		const IAssetRegistry* const AssetRegistry{ IAssetRegistry::Get() };
+		bool bResult{ false };
+		if (AssetRegistry && !AssetRegistry->IsLoadingAssets())
+		{
+			bResult = AssetRegistry->HasAssets(PackageName);
+		}
+		else
+		{
+			// The registry doesn't know every package until its initial scan has finished
+			bResult = FPackageName::DoesPackageExist(PackageName.ToString());
+		}
+
+		if (!bResult)
+		{
+			FGCScopeGuard GCGuard{};
+			bResult = FindPackage(nullptr, *PackageName.ToString()) != nullptr;
+		}
+		return bResult;
+	}
+}
 #endif //WITH_EDITOR
 
 void UHyperlinkSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
+	LLM_SCOPE_BYTAG(Hyperlink);
+	
 	/*
 	 * Here we only want to initialise the definitions if we are in a game environment. If we are in an editor
 	 * environment then we want to let UHyperlinkSettings call initialise when all the editor classes are ready
@@ -28,9 +83,22 @@ void UHyperlinkSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 	if (!GIsEditor)
 #endif //WITH_EDITOR
 	{
-		InitDefinitions();
+		UpdateDefinitions();
 	}
 
+	ResetLinkStore();
+
+#if WITH_EDITOR
+	// Links can arrive at any time, so they're queued and executed after the editor tick
+	LinkInbox = MakeUnique<FHyperlinkLinkInbox>(FHyperlinkInboxConstants::Capacity);
+	PostEditorTickHandle = GEngine->OnPostEditorTick().AddUObject(this, &UHyperlinkSubsystem::DrainLinkInbox);
+	if (GEditor)
+	{
+		ThrottlingHandle = GEditor->AddShouldDisableCPUThrottlingDelegate(
+			UEditorEngine::FShouldDisableCPUThrottling::CreateUObject(this, &UHyperlinkSubsystem::IsReceivingLink));
+	}
+#endif //WITH_EDITOR
+
 	// Register console commands
 	IConsoleObject* const HelpConsoleCommand
 	{
@@ -50,6 +118,34 @@ void UHyperlinkSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 	};
 	ConsoleCommands.Emplace(CopyConsoleCommand);
 
+	IConsoleObject* const CopyLinksConsoleCommand
+	{
+		IConsoleManager::Get().RegisterConsoleCommand(
+		TEXT("uhl.CopyLinks"),
+		TEXT(R"(Copy a link of the specified type for each selected item. For example: "uhl.CopyLinks Edit")"),
+		FConsoleCommandWithArgsDelegate::CreateUObject(this, &UHyperlinkSubsystem::CopyLinksConsole))
+	};
+	ConsoleCommands.Emplace(CopyLinksConsoleCommand);
+
+	IConsoleObject* const LinkCacheStatsConsoleCommand
+	{
+		IConsoleManager::Get().RegisterConsoleCommand(
+		TEXT("uhl.LinkCacheStats"),
+		TEXT("Print the hit and miss counts of the link cache"),
+		FConsoleCommandDelegate::CreateUObject(this, &UHyperlinkSubsystem::LinkCacheStatsConsole))
+	};
+	ConsoleCommands.Emplace(LinkCacheStatsConsoleCommand);
+
+	IConsoleObject* const StartupReportConsoleCommand
+	{
+		IConsoleManager::Get().RegisterConsoleCommand(
+		TEXT("uhl.StartupReport"),
+		*FString::Printf(TEXT("Print the time and memory used by each plugin startup phase and definition, and write "
+			"them to %s"), *FHyperlinkStartupProfiler::GetReportPath()),
+		FConsoleCommandDelegate::CreateStatic(&UHyperlinkSubsystem::StartupReportConsole))
+	};
+	ConsoleCommands.Emplace(StartupReportConsoleCommand);
+
 #if WITH_EDITOR
 	IConsoleObject* const ExecuteConsoleCommand
 	{
@@ -65,7 +161,31 @@ void UHyperlinkSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 
 void UHyperlinkSubsystem::Deinitialize()
 {
+#if WITH_EDITOR
+	if (GEngine)
+	{
+		GEngine->OnPostEditorTick().Remove(PostEditorTickHandle);
+	}
+	if (GEditor)
+	{
+		GEditor->RemoveShouldDisableCPUThrottlingDelegate(ThrottlingHandle);
+	}
+	PostEditorTickHandle.Reset();
+	ThrottlingHandle.Reset();
+	LinkInbox.Reset();
+	
+	if (BundleLoadHandle.IsValid())
+	{
+		BundleLoadHandle->CancelHandle();
+		BundleLoadHandle.Reset();
+	}
+	LoadedBundle.Reset();
+#endif //WITH_EDITOR
+	
 	DeinitDefinitions();
+	PublishDefinitionSnapshot();
+	bDefinitionsInitialized = false;
+	LinkStore.Reset();
 	for (IConsoleObject* const ConsoleCommand : ConsoleCommands)
 	{
 		IConsoleManager::Get().UnregisterConsoleObject(ConsoleCommand);
@@ -74,68 +194,386 @@ void UHyperlinkSubsystem::Deinitialize()
 
 void UHyperlinkSubsystem::RefreshDefinitions()
 {
-	DeinitDefinitions();
-	InitDefinitions();
+	// Cached links may use identifiers which have changed
+	if (UpdateDefinitions())
+	{
+		FHyperlinkUtility::ResetLinkCache();
+	}
+}
+
+void UHyperlinkSubsystem::ResetLinkStore()
+{
+	// Release the old store first so its segments are unmapped before the new store maps them. A link being decoded
+	// on another thread may keep it alive a little longer, which only delays the unmapping
+	LinkStore.Reset();
+	FHyperlinkUtility::ResetLinkCache();
+	
+	const UHyperlinkSettings* const Settings{ GetDefault<UHyperlinkSettings>() };
+	if (Settings->GetUseLinkStore())
+	{
+		LinkStore = MakeShared<FHyperlinkLinkStore, ESPMode::ThreadSafe>(Settings->GetLinkStoreDirectory(),
+			Settings->GetLinkStoreTimeToLive());
+		LinkStore->Compact();
+	}
 }
 
 UHyperlinkDefinition* UHyperlinkSubsystem::GetDefinition(
 	const TSubclassOf<UHyperlinkDefinition> DefinitionClass) const
 {
-	UHyperlinkDefinition* Ret{ nullptr };
-	for (const TPair<FString, TObjectPtr<UHyperlinkDefinition>>& Pair : Definitions)
+	const TSharedRef<const FHyperlinkDefinitionSnapshot, ESPMode::ThreadSafe> Snapshot{ GetDefinitionSnapshot() };
+	const FHyperlinkDefinitionSnapshot::FEntry* const Entry{ Snapshot->FindByClass(DefinitionClass) };
+	return Entry ? Entry->Definition.Get() : nullptr;
+}
+
+UHyperlinkDefinition* UHyperlinkSubsystem::GetDefinition(const FString& Identifier) const
+{
+	const TSharedRef<const FHyperlinkDefinitionSnapshot, ESPMode::ThreadSafe> Snapshot{ GetDefinitionSnapshot() };
+	const FHyperlinkDefinitionSnapshot::FEntry* const Entry{ Snapshot->FindByIdentifier(Identifier) };
+	return Entry ? Entry->Definition.Get() : nullptr;
+}
+
+FString UHyperlinkSubsystem::FindIdentifier(const UClass* const DefinitionClass) const
+{
+	// The snapshot also finds subclasses, but only the exact class is registered with the identifier
+	const TSharedRef<const FHyperlinkDefinitionSnapshot, ESPMode::ThreadSafe> Snapshot{ GetDefinitionSnapshot() };
+	const FHyperlinkDefinitionSnapshot::FEntry* const Entry{ Snapshot->FindByClass(DefinitionClass) };
+	return Entry && Entry->Class == FObjectKey(DefinitionClass) ? Entry->Identifier : FString();
+}
+
+UHyperlinkDefinition* UHyperlinkSubsystem::LoadDefinition(const FString& Identifier)
+{
+	UHyperlinkDefinition* Ret{ GetDefinition(Identifier) };
+#if WITH_EDITOR
+	if (Ret == nullptr)
 	{
-		if (Pair.Value->IsA(DefinitionClass))
+		if (const TSoftClassPtr<UHyperlinkDefinition>* const Class{ UnloadedClasses.Find(Identifier) })
 		{
-			Ret = Pair.Value;
-			break;
+			// Not preloaded, or needed before the background load finished
+			if (Class->LoadSynchronous())
+			{
+				RefreshDefinitions();
+				Ret = GetDefinition(Identifier);
+			}
 		}
 	}
+	InitializeDeferredDefinition(Ret);
+#endif //WITH_EDITOR
 	return Ret;
 }
 
-void UHyperlinkSubsystem::InitDefinitions()
+#if WITH_EDITOR
+void UHyperlinkSubsystem::LoadUnloadedClassesAsync()
+{
+	TArray<FSoftObjectPath> ClassPaths{};
+	// Otherwise each class is loaded on demand by LoadDefinition
+	if (GetDefault<UHyperlinkSettings>()->GetPreloadBlueprintDefinitions())
+	{
+		for (const TPair<FString, TSoftClassPtr<UHyperlinkDefinition>>& Pair : UnloadedClasses)
+		{
+			// Each class is only requested once, so a class which fails to load isn't requested again on every refresh
+			bool bAlreadyRequested{ false };
+			RequestedClassPaths.Emplace(Pair.Value.ToSoftObjectPath(), &bAlreadyRequested);
+			if (!bAlreadyRequested)
+			{
+				ClassPaths.Emplace(Pair.Value.ToSoftObjectPath());
+			}
+		}
+	}
+
+	if (ClassPaths.Num() > 0)
+	{
+		// Load off the startup path. Once loaded the refresh creates the definitions, which adds their menu entries
+		UAssetManager::GetStreamableManager().RequestAsyncLoad(MoveTemp(ClassPaths),
+			FStreamableDelegate::CreateWeakLambda(this, [this]() { RefreshDefinitions(); }),
+			FStreamableManager::DefaultAsyncLoadPriority);
+	}
+}
+
+void UHyperlinkSubsystem::InitializeOrDeferDefinition(UHyperlinkDefinition* const Definition)
+{
+	TArray<FName> MenuNames{};
+	if (GetDefault<UHyperlinkSettings>()->GetDeferDefinitionInitialize() && GIsEditor
+		&& Definition->GetDeferredInitializeMenus(MenuNames))
+	{
+		UninitializedDefinitions.Emplace(Definition);
+		for (const FName& MenuName : MenuNames)
+		{
+			bool bAlreadyDeferred{ false };
+			DeferredMenuNames.Emplace(MenuName, &bAlreadyDeferred);
+			if (!bAlreadyDeferred)
+			{
+				// One cheap dynamic section per menu, shared by every definition extending it
+				static const FName PlaceholderSectionName{ TEXT("HyperlinkDeferred") };
+				UToolMenus::Get()->ExtendMenu(MenuName)->AddDynamicSection(PlaceholderSectionName,
+					FNewToolMenuDelegate::CreateUObject(this, &UHyperlinkSubsystem::OnDeferredMenuGenerated, MenuName));
+			}
+		}
+	}
+	else
+	{
+		InitializeDefinition(Definition);
+	}
+}
+
+void UHyperlinkSubsystem::InitializeDeferredDefinition(UHyperlinkDefinition* const Definition)
+{
+	if (Definition && UninitializedDefinitions.Remove(Definition) > 0)
+	{
+		InitializeDefinition(Definition);
+	}
+}
+
+void UHyperlinkSubsystem::OnDeferredMenuGenerated(UToolMenu* const InMenu, const FName MenuName)
+{
+	TArray<UHyperlinkDefinition*> MenuDefinitions{};
+	for (UHyperlinkDefinition* const Definition : UninitializedDefinitions)
+	{
+		TArray<FName> MenuNames{};
+		Definition->GetDeferredInitializeMenus(MenuNames);
+		if (MenuNames.Contains(MenuName))
+		{
+			MenuDefinitions.Emplace(Definition);
+		}
+	}
+
+	if (MenuDefinitions.Num() > 0)
+	{
+		// The menu being generated was assembled before the definitions extend it, so copy their new entries into it
+		const UToolMenu* const RegisteredMenu{ UToolMenus::Get()->FindMenu(MenuName) };
+		TSet<TPair<FName, FName>> ExistingEntries{};
+		for (const FToolMenuSection& Section : RegisteredMenu->Sections)
+		{
+			for (const FToolMenuEntry& Entry : Section.Blocks)
+			{
+				ExistingEntries.Emplace(Section.Name, Entry.Name);
+			}
+		}
+
+		for (UHyperlinkDefinition* const Definition : MenuDefinitions)
+		{
+			InitializeDeferredDefinition(Definition);
+		}
+
+		for (const FToolMenuSection& Section : RegisteredMenu->Sections)
+		{
+			for (const FToolMenuEntry& Entry : Section.Blocks)
+			{
+				if (!ExistingEntries.Contains(TPair<FName, FName>(Section.Name, Entry.Name)))
+				{
+					FToolMenuSection& MenuSection{ InMenu->FindOrAddSection(Section.Name) };
+					if (!MenuSection.FindEntry(Entry.Name))
+					{
+						MenuSection.AddEntry(Entry);
+					}
+				}
+			}
+		}
+	}
+}
+#endif //WITH_EDITOR
+
+void UHyperlinkSubsystem::InitializeDefinition(UHyperlinkDefinition* const Definition)
+{
+	// Definitions register their commands and menu entries here
+	LLM_SCOPE_BYTAG(Hyperlink);
+	const FHyperlinkStartupProfiler::FScope ProfilerScope
+		{ FString::Printf(TEXT("%s::Initialize"), *Definition->GetClass()->GetName()) };
+	Definition->Initialize();
+}
+
+void UHyperlinkSubsystem::DeinitializeDefinition(UHyperlinkDefinition* const Definition)
 {
-	// Create object for each of the project definitions
+	const FHyperlinkStartupProfiler::FScope ProfilerScope
+		{ FString::Printf(TEXT("%s::Deinitialize"), *Definition->GetClass()->GetName()) };
+	Definition->Deinitialize();
+}
+
+bool UHyperlinkSubsystem::UpdateDefinitions()
+{
+	const FHyperlinkStartupProfiler::FScope ProfilerScope{ TEXT("UHyperlinkSubsystem::UpdateDefinitions") };
+	LLM_SCOPE_BYTAG(Hyperlink);
+	const double StartTime{ FPlatformTime::Seconds() };
+	
+#if WITH_EDITOR
+	const TMap<FString, TSoftClassPtr<UHyperlinkDefinition>> OldUnloadedClasses{ MoveTemp(UnloadedClasses) };
+	UnloadedClasses.Reset();
+#endif //WITH_EDITOR
+	
+	// Classes the settings register by identifier
+	TMap<FString, UClass*> RegisteredClasses{};
 	for (const FHyperlinkClassEntry& ClassEntry : GetDefault<UHyperlinkSettings>()->GetRegisteredDefinitions())
 	{
+		if (!ClassEntry.bEnabled || ClassEntry.Class.IsNull())
+		{
+			continue;
+		}
+		
+		if (RegisteredClasses.Contains(ClassEntry.Identifier)
+#if WITH_EDITOR
+			|| UnloadedClasses.Contains(ClassEntry.Identifier)
+#endif //WITH_EDITOR
+			)
+		{
+			UE_LOG(LogHyperlink, Warning, TEXT("Cannot register %s: a class is already using the identifier \"%s\""),
+				*ClassEntry.Class.GetAssetName(), *ClassEntry.Identifier);
+		}
 		/*
 		 * Note: How does the TSoftObjectPtr of ClassEntry.Class resolve when use it in the boolean expression below?
 		 * The TSoftObjectPtr is resolved by calling FSoftObjectPath::ResolveObjectInternal which uses FindObject to
 		 * try and load the class via its path. If it can't be loaded via path (e.g. python module not loaded or
-		 * asset registry hasn't discovered a Blutility) then it returns nullptr and this block will be skipped
+		 * a Blueprint class which hasn't been loaded yet) then it returns nullptr and this block will be skipped
 		 */
-		if (ClassEntry.bEnabled && ClassEntry.Class)
+		else if (ClassEntry.Class)
+		{
+			/*
+			 * Note: It's fine to use Get() instead of LoadSynchronous() since the class will always be loaded by 
+			 * resolve discussed above
+			 */
+			RegisteredClasses.Emplace(ClassEntry.Identifier, ClassEntry.Class.Get());
+		}
+#if WITH_EDITOR
+		else
+		{
+			// Blueprint definitions are registered from the asset registry without loading their class
+			UnloadedClasses.Emplace(ClassEntry.Identifier, ClassEntry.Class);
+		}
+#endif //WITH_EDITOR
+	}
+
+	// Take out the definitions which are no longer registered with their identifier. They are kept by class so a
+	// renamed definition can be moved to its new identifier without being initialized again. A class may be registered
+	// with more than one identifier, so each class can have several
+	TMultiMap<const UClass*, TObjectPtr<UHyperlinkDefinition>> StaleDefinitions{};
+	for (auto It{ Definitions.CreateIterator() }; It; ++It)
+	{
+		UClass* const* const RegisteredClass{ RegisteredClasses.Find(It.Key()) };
+		if (!RegisteredClass || *RegisteredClass != It.Value()->GetClass())
+		{
+			StaleDefinitions.Emplace(It.Value()->GetClass(), It.Value());
+			It.RemoveCurrent();
+		}
+	}
+
+	int32 NumAdded{ 0 };
+	int32 NumRenamed{ 0 };
+	for (const TPair<FString, UClass*>& Pair : RegisteredClasses)
+	{
+		if (!Definitions.Contains(Pair.Key))
 		{
-			if (!Definitions.Contains(ClassEntry.Identifier))
+			TObjectPtr<UHyperlinkDefinition> Definition{ nullptr };
+			if (const TObjectPtr<UHyperlinkDefinition>* const StaleDefinition{ StaleDefinitions.Find(Pair.Value) })
 			{
-				/*
-				 * Note: It's fine to use Get() instead of LoadSynchronous() since the class will always be loaded by 
-				 * resolve discussed above
-				 */
-				TObjectPtr<UHyperlinkDefinition> NewDefinition
-					{ NewObject<UHyperlinkDefinition>(this, ClassEntry.Class.Get()) };
-				NewDefinition->Initialize();
-				Definitions.Emplace(ClassEntry.Identifier, NewDefinition);
+				Definition = *StaleDefinition;
+				StaleDefinitions.RemoveSingle(Pair.Value, Definition);
+				++NumRenamed;
 			}
 			else
 			{
-				UE_LOG(LogHyperlink, Warning, TEXT("Cannot register %s: a class is already using the identifier \"%s\""),
-					*ClassEntry.Class->GetName(), *ClassEntry.Identifier);
+				Definition = NewObject<UHyperlinkDefinition>(this, Pair.Value);
+				Definition->PreInitialize();
+#if WITH_EDITOR
+				InitializeOrDeferDefinition(Definition);
+#else
+				InitializeDefinition(Definition);
+#endif //WITH_EDITOR
+				++NumAdded;
 			}
+			Definitions.Emplace(Pair.Key, Definition);
+		}
+	}
+
+	for (const TPair<const UClass*, TObjectPtr<UHyperlinkDefinition>>& Pair : StaleDefinitions)
+	{
+#if WITH_EDITOR
+		if (UninitializedDefinitions.Remove(Pair.Value) == 0)
+#endif //WITH_EDITOR
+		{
+			DeinitializeDefinition(Pair.Value);
 		}
+		Pair.Value->PostDeinitialize();
 	}
+
+	bool bChanged{ NumAdded > 0 || NumRenamed > 0 || StaleDefinitions.Num() > 0 };
+#if WITH_EDITOR
+	bChanged |= !UnloadedClasses.OrderIndependentCompareEqual(OldUnloadedClasses);
+	LoadUnloadedClassesAsync();
+#endif //WITH_EDITOR
+	if (bChanged)
+	{
+		PublishDefinitionSnapshot();
+	}
+	bDefinitionsInitialized = true;
+
+	UE_LOG(LogHyperlink, Verbose, TEXT("Updated definitions in %.2fms: %d added, %d removed, %d renamed, %d unchanged"),
+		(FPlatformTime::Seconds() - StartTime) * 1000.0, NumAdded, StaleDefinitions.Num(), NumRenamed,
+		Definitions.Num() - NumAdded - NumRenamed);
+	
+	return bChanged;
 }
 
 void UHyperlinkSubsystem::DeinitDefinitions()
 {
 	for (const TPair<FString, TObjectPtr<UHyperlinkDefinition>>& Pair : Definitions)
 	{
+		if (Pair.Value
+#if WITH_EDITOR
+			&& !UninitializedDefinitions.Contains(Pair.Value)
+#endif //WITH_EDITOR
+			)
+		{
+			DeinitializeDefinition(Pair.Value);
+		}
 		if (Pair.Value)
 		{
-			Pair.Value->Deinitialize();
+			Pair.Value->PostDeinitialize();
 		}
 	}
 	Definitions.Empty();
+#if WITH_EDITOR
+	UninitializedDefinitions.Empty();
+#endif //WITH_EDITOR
+}
+
+void UHyperlinkSubsystem::PublishDefinitionSnapshot()
+{
+	// Build a new snapshot rather than modifying the current one, which other threads may be reading
+	const TSharedRef<FHyperlinkDefinitionSnapshot, ESPMode::ThreadSafe> NewSnapshot
+		{ MakeShared<FHyperlinkDefinitionSnapshot, ESPMode::ThreadSafe>() };
+	for (const TPair<FString, TObjectPtr<UHyperlinkDefinition>>& Pair : Definitions)
+	{
+		NewSnapshot->Add(Pair.Key, Pair.Value);
+	}
+#if WITH_EDITOR
+	for (const TPair<FString, TSoftClassPtr<UHyperlinkDefinition>>& Pair : UnloadedClasses)
+	{
+		NewSnapshot->AddUnloaded(Pair.Key);
+	}
+#endif //WITH_EDITOR
+
+	// A reader may have loaded the previous snapshot without referencing it yet, so it's retired rather than released
+	RetiredSnapshots.Add(DefinitionSnapshot);
+	DefinitionSnapshot = NewSnapshot;
+	PublishedSnapshot.store(&NewSnapshot.Get(), std::memory_order_seq_cst);
+	ReleaseRetiredSnapshots();
+}
+
+void UHyperlinkSubsystem::ReleaseRetiredSnapshots()
+{
+	// Readers count themselves before loading the pointer, so once none are counted after the swap, any reader still
+	// to come will load the new snapshot. Each snapshot is then destroyed once every reader has released it
+	if (!RetiredSnapshots.IsEmpty() && NumSnapshotReaders.load(std::memory_order_seq_cst) == 0)
+	{
+		RetiredSnapshots.Reset();
+	}
+}
+
+TSharedRef<const FHyperlinkDefinitionSnapshot, ESPMode::ThreadSafe> UHyperlinkSubsystem::GetDefinitionSnapshot() const
+{
+	NumSnapshotReaders.fetch_add(1, std::memory_order_seq_cst);
+	TSharedRef<const FHyperlinkDefinitionSnapshot, ESPMode::ThreadSafe> Snapshot
+		{ PublishedSnapshot.load(std::memory_order_seq_cst)->AsShared() };
+	NumSnapshotReaders.fetch_sub(1, std::memory_order_seq_cst);
+	return Snapshot;
 }
 
 void UHyperlinkSubsystem::HelpConsole(const TArray<FString>& Args)
@@ -157,6 +595,39 @@ void UHyperlinkSubsystem::HelpConsole(const TArray<FString>& Args)
 	}
 }
 
+/*static*/void UHyperlinkSubsystem::StartupReportConsole()
+{
+	FHyperlinkStartupProfiler::PrintReport();
+	FHyperlinkStartupProfiler::WriteReport();
+}
+
+void UHyperlinkSubsystem::LinkCacheStatsConsole() const
+{
+	const FHyperlinkUtility::FLinkCacheStats Stats{ FHyperlinkUtility::GetLinkCacheStats() };
+	const uint64 NumLookups{ Stats.NumHits + Stats.NumMisses };
+	UE_LOG(LogHyperlink, Display, TEXT("Link cache: %llu hits, %llu misses (%.1f%% hit rate), %d cached links"),
+		Stats.NumHits, Stats.NumMisses, NumLookups > 0 ? 100.0 * Stats.NumHits / NumLookups : 0.0,
+		Stats.NumEntries);
+}
+
+void UHyperlinkSubsystem::CopyLinksConsole(const TArray<FString>& Args)
+{
+	if (Args.Num() < 1)
+	{
+		UE_LOG(LogHyperlink, Display, TEXT("Invalid arguments, must have at least 1 argument"));
+	}
+	else if (UHyperlinkDefinition* const Def{ LoadDefinition(Args[0]) })
+	{
+		TArray<FString> LinkArgs{ Args };
+		LinkArgs.RemoveAt(0);
+		Def->CopyLinks(LinkArgs);
+	}
+	else
+	{
+		UE_LOG(LogHyperlink, Error, TEXT("No registered definition with the identifier %s"), *Args[0]);
+	}
+}
+
 void UHyperlinkSubsystem::CopyLinkConsole(const TArray<FString>& Args)
 {
 	if (Args.Num() < 1)
@@ -165,12 +636,12 @@ void UHyperlinkSubsystem::CopyLinkConsole(const TArray<FString>& Args)
 	}
 	else
 	{
-		if (const TObjectPtr<UHyperlinkDefinition>* Def{ Definitions.Find(Args[0]) })
+		if (UHyperlinkDefinition* const Def{ LoadDefinition(Args[0]) })
 		{
 			// Copy array and remove first arg, pass remainder to generate the link
 			TArray<FString> LinkArgs{ Args };
 			LinkArgs.RemoveAt(0);
-			(*Def)->CopyLink(LinkArgs);
+			Def->CopyLink(LinkArgs);
 		}
 		else
 		{
@@ -192,37 +663,210 @@ void UHyperlinkSubsystem::StaticExecuteLink(const FHyperlinkExecutePayload& Exec
 	}
 }
 
-void UHyperlinkSubsystem::ExecuteLink(const FHyperlinkExecutePayload& ExecutePayload)
+void UHyperlinkSubsystem::BeginReceiveLink()
+{
+	if (!LinkReceivedTime.IsSet())
+	{
+		LinkReceivedTime = FPlatformTime::Seconds();
+		UE_LOG(LogHyperlink, Verbose, TEXT("Link received, disabling background CPU throttling"));
+	}
+	++NumReceivingLinks;
+}
+
+void UHyperlinkSubsystem::EndReceiveLink()
+{
+	if (ensure(NumReceivingLinks > 0))
+	{
+		--NumReceivingLinks;
+	}
+}
+
+void UHyperlinkSubsystem::UpdateReceivingLink()
 {
-	// Proceed if we're not already executing a link
-	if (!PostEditorTickHandle.IsValid())
+	if (LinkReceivedTime.IsSet())
 	{
-		// Need to defer this to after editor tick is complete to ensure we avoid any crashes
-		// This is particularly important when the link handles opening a level
-		PostEditorTickHandle = GEngine->OnPostEditorTick().AddWeakLambda(this, [=, this](float DeltaTime)
+		const double ElapsedSeconds{ FPlatformTime::Seconds() - LinkReceivedTime.GetValue() };
+		const bool bExecuted{ NumReceivingLinks == 0 && LinkInbox->IsEmpty() && !LoadedBundle.IsSet()
+			&& !BundleLoadHandle.IsValid() && !FHyperlinkUtility::IsLoadPending() };
+		if (bExecuted)
 		{
-			ExecuteLinkDeferred(ExecutePayload);
-			// Clear delegate
-			GEngine->OnPostEditorTick().Remove(PostEditorTickHandle);
-			PostEditorTickHandle.Reset();
-		});
+			UE_LOG(LogHyperlink, Log, TEXT("Link executed %.1fms after it was received"), ElapsedSeconds * 1000.0);
+			LinkReceivedTime.Reset();
+		}
+		else if (ElapsedSeconds > FHyperlinkInboxConstants::MaxUnthrottledSeconds)
+		{
+			UE_LOG(LogHyperlink, Warning, TEXT("Link still executing after %.0fs, restoring background CPU throttling"),
+				ElapsedSeconds);
+			LinkReceivedTime.Reset();
+		}
 	}
 }
 
-void UHyperlinkSubsystem::ExecuteLink(const FString& InString)
+EHyperlinkQueueResult UHyperlinkSubsystem::QueueLink(const FHyperlinkExecutePayload& ExecutePayload)
 {
-	// Replace any escaped characters in the input string
-	const FString ParsedString{ UHyperlinkPythonBridge::GetChecked().ParseUrlString(InString) };
+	// Need to defer this to after editor tick is complete to ensure we avoid any crashes
+	// This is particularly important when the link handles opening a level
+	LLM_SCOPE_BYTAG(Hyperlink);
+	EHyperlinkQueueResult Result{ EHyperlinkQueueResult::Dropped };
 	
-	FHyperlinkExecutePayload Payload{};
-	if (TryGetPayloadFromString(ParsedString, Payload))
+	if (LinkInbox.IsValid())
+	{
+		// Coalesce before queueing so the sender is told the link was merged rather than queued. Payload objects only
+		// come from Blueprint calls, so only payload strings are compared
+		const bool bCoalesce{ !ExecutePayload.DefinitionPayload.JsonString.IsEmpty() };
+		TTuple<FString, const UClass*, FString> Key{};
+		bool bIsDuplicate{ false };
+		if (bCoalesce)
+		{
+			Key = MakeTuple(ExecutePayload.Identifier, ExecutePayload.Class.Get(),
+				ExecutePayload.DefinitionPayload.JsonString);
+			const double Now{ FPlatformTime::Seconds() };
+			
+			FScopeLock Lock{ &RecentPayloadsLock };
+			const double* const QueuedTime{ RecentPayloads.Find(Key) };
+			bIsDuplicate = QueuedTime && Now - *QueuedTime < FHyperlinkInboxConstants::CoalesceWindowSeconds;
+			if (bIsDuplicate)
+			{
+				++NumCoalescedPayloads;
+			}
+			else
+			{
+				// Recorded before pushing so the same link queued at the same time on another thread is coalesced
+				RecentPayloads.Emplace(Key, Now);
+			}
+		}
+		
+		if (bIsDuplicate)
+		{
+			Result = EHyperlinkQueueResult::Coalesced;
+			INC_DWORD_STAT(STAT_HyperlinkLinksCoalesced);
+			FHyperlinkMetrics::RecordCoalesced();
+		}
+		else if (LinkInbox->Push(ExecutePayload))
+		{
+			Result = EHyperlinkQueueResult::Queued;
+			INC_DWORD_STAT(STAT_HyperlinkLinksQueued);
+		}
+		else if (bCoalesce)
+		{
+			// Dropped, so sending the link again must not be coalesced with it
+			FScopeLock Lock{ &RecentPayloadsLock };
+			RecentPayloads.Remove(Key);
+		}
+	}
+	
+	return Result;
+}
+
+bool UHyperlinkSubsystem::ExecuteLink(const FHyperlinkExecutePayload& ExecutePayload)
+{
+	return QueueLink(ExecutePayload) != EHyperlinkQueueResult::Dropped;
+}
+
+void UHyperlinkSubsystem::ExecuteBundle(TArray<FHyperlinkExecutePayload> Payloads)
+{
+	if (BundleLoadHandle.IsValid())
+	{
+		UE_LOG(LogHyperlink, Display, TEXT("Replacing the bundle which is still loading"));
+		BundleLoadHandle->CancelHandle();
+		BundleLoadHandle.Reset();
+	}
+	LoadedBundle.Reset();
+
+	// Gather the packages of every link so they load together instead of one after another as each link executes
+	TArray<FName> PackageNames{};
+	for (const FHyperlinkExecutePayload& Payload : Payloads)
 	{
-		ExecuteLink(Payload);
+		if (const UHyperlinkDefinition* const Definition{ FindPayloadDefinition(Payload) })
+		{
+			Definition->GetPayloadDependencies(Payload.DefinitionPayload.JsonString, PackageNames);
+		}
+	}
+
+	// Every asset in each package is requested, rather than assuming an asset shares the name of its package
+	TArray<FSoftObjectPath> AssetPaths{};
+	TArray<FName> LoadingPackageNames{};
+	TArray<FAssetData> PackageAssets{};
+	for (const FName& PackageName : PackageNames)
+	{
+		const UPackage* const Package
+			{ !PackageName.IsNone() ? FindPackage(nullptr, *PackageName.ToString()) : nullptr };
+		if (!PackageName.IsNone() && !(Package && Package->IsFullyLoaded()))
+		{
+			PackageAssets.Reset();
+			IAssetRegistry::GetChecked().GetAssetsByPackageName(PackageName, PackageAssets);
+			for (const FAssetData& AssetData : PackageAssets)
+			{
+				AssetPaths.AddUnique(AssetData.GetSoftObjectPath());
+			}
+			LoadingPackageNames.AddUnique(PackageName);
+		}
+	}
+
+	if (AssetPaths.Num() > 0 && UAssetManager::IsInitialized())
+	{
+		const double StartTime{ FPlatformTime::Seconds() };
+		BundleLoadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(MoveTemp(AssetPaths),
+			FStreamableDelegate::CreateWeakLambda(this, [this, Payloads, LoadingPackageNames, StartTime]()
+			{
+				// Fully load each package so the links take FHyperlinkUtility::LoadObjectAsync's synchronous path
+				for (const FName& PackageName : LoadingPackageNames)
+				{
+					if (UPackage* const Package{ FindPackage(nullptr, *PackageName.ToString()) })
+					{
+						Package->FullyLoad();
+					}
+				}
+				UE_LOG(LogHyperlink, Display, TEXT("Loaded %d packages for bundle of %d links in %.1fms"),
+					LoadingPackageNames.Num(), Payloads.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+				
+				// Loading completes mid-tick, so execute after the editor tick as in ExecuteLink
+				LoadedBundle.Emplace(Payloads);
+			}),
+			FStreamableManager::AsyncLoadHighPriority);
 	}
 	else
 	{
-		UE_LOG(LogHyperlink, Error, TEXT("Failed to deserialize link payload: %s"), *InString);
+		// Nothing to load, we're already executing after the editor tick
+		ExecuteBundleDeferred(Payloads);
+	}
+}
+
+bool UHyperlinkSubsystem::ExecuteLink(const FStringView InString)
+{
+	FHyperlinkExecutePayload Payload{};
+	const EHyperlinkDecodeResult DecodeResult{ DecodeLink(InString, *GetDefinitionSnapshot(), LinkStore.Get(), Payload) };
+	FHyperlinkMetrics::RecordDecode(DecodeResult);
+	
+	bool bResult{ false };
+	switch (DecodeResult)
+	{
+	case EHyperlinkDecodeResult::Success:
+		bResult = ExecuteLink(Payload);
+		break;
+	case EHyperlinkDecodeResult::Malformed:
+		{
+			// Avoid flooding the log if the whole clipboard has been pasted
+			static constexpr int32 MaxLoggedLength{ 256 };
+			UE_LOG(LogHyperlink, Error, TEXT("Failed to deserialize link payload: %s%s"),
+				*FString(InString.Right(MaxLoggedLength)),
+				InString.Len() > MaxLoggedLength ? TEXT(" (truncated)") : TEXT(""));
+		}
+		break;
+	case EHyperlinkDecodeResult::NotStored:
+		UE_LOG(LogHyperlink, Error, TEXT("Link payload was not found in the link store, it may have expired or not been "
+			"synced yet"));
+		break;
+	case EHyperlinkDecodeResult::UnknownDefinition:
+		UE_LOG(LogHyperlink, Error, TEXT("Could not find registered definition %s"),
+			Payload.Identifier.IsEmpty() ? *GetNameSafe(Payload.Class) : *Payload.Identifier);
+		break;
+	case EHyperlinkDecodeResult::MissingAsset:
+		UE_LOG(LogHyperlink, Error, TEXT("Link not executed, an asset it opens doesn't exist"));
+		break;
 	}
+
+	return bResult;
 }
 
 void UHyperlinkSubsystem::ExecuteLinkConsole(const TArray<FString>& Args)
@@ -234,32 +878,68 @@ void UHyperlinkSubsystem::ExecuteLinkConsole(const TArray<FString>& Args)
 	}
 	else
 	{
-		ExecuteLink(Args[0].TrimQuotes());
+		// Equivalent of FString::TrimQuotes without the copy
+		FStringView Link{ Args[0] };
+		if (Link.StartsWith(TEXT('"')))
+		{
+			Link.RightChopInline(1);
+		}
+		if (Link.EndsWith(TEXT('"')))
+		{
+			Link.LeftChopInline(1);
+		}
+		ExecuteLink(Link);
 	}
 }
 
 // NOLINTNEXTLINE(performance-unnecessary-value-param) : when passed by ref passed variable goes out of scope
-void UHyperlinkSubsystem::ExecuteLinkDeferred(const FHyperlinkExecutePayload ExecutePayload) const
+void UHyperlinkSubsystem::ExecuteLinkDeferred(const FHyperlinkExecutePayload ExecutePayload)
 {
-	if (ExecutePayload.Class && ExecutePayload.DefinitionPayload.JsonObject.IsValid())
+	HYPERLINK_SCOPE_CYCLE_COUNTER(STAT_HyperlinkDispatch);
+	
+	const bool bHasIdentifier{ !ExecutePayload.Identifier.IsEmpty() };
+	const FJsonObjectWrapper& DefinitionPayload{ ExecutePayload.DefinitionPayload };
+	if ((bHasIdentifier || ExecutePayload.Class)
+		&& (DefinitionPayload.JsonObject.IsValid() || !DefinitionPayload.JsonString.IsEmpty()))
 	{
-		if (UHyperlinkDefinition* const Definition{ GetDefinition(ExecutePayload.Class) })
+		if (UHyperlinkDefinition* const Definition{ FindPayloadDefinition(ExecutePayload) })
 		{
-			Definition->ExecutePayload(ExecutePayload.DefinitionPayload.JsonObject.ToSharedRef());
+			if (!bDryRun)
+			{
+				const double StartTime{ FPlatformTime::Seconds() };
+				
+				// Links are read into the string, the object is only set when called from e.g. the remote control API
+				if (DefinitionPayload.JsonObject.IsValid())
+				{
+					Definition->ExecutePayload(DefinitionPayload.JsonObject.ToSharedRef());
+				}
+				else if (!Definition->ExecutePayloadString(DefinitionPayload.JsonString))
+				{
+					UE_LOG(LogHyperlink, Error, TEXT("%s could not read link payload: %s"),
+						*Definition->GetClass()->GetName(), *DefinitionPayload.JsonString);
+				}
 
-			// Focus the editor window
-			const IMainFrameModule& MainFrameModule = IMainFrameModule::Get();
+				const FString Identifier{ bHasIdentifier ? ExecutePayload.Identifier
+					: FindIdentifier(Definition->GetClass()) };
+				FHyperlinkMetrics::RecordExecuted(
+					!Identifier.IsEmpty() ? Identifier : Definition->GetClass()->GetName(),
+					FPlatformTime::Seconds() - StartTime);
 
-			if (const TSharedPtr<SWindow> Window{ MainFrameModule.GetParentWindow() })
-			{
-				Window->HACK_ForceToFront();
+				// Focus the editor window
+				const IMainFrameModule& MainFrameModule = IMainFrameModule::Get();
+
+				if (const TSharedPtr<SWindow> Window{ MainFrameModule.GetParentWindow() })
+				{
+					Window->HACK_ForceToFront();
+				}
 			}
 			
+			LinkDispatchedDelegate.Broadcast(ExecutePayload);
 		}
 		else
 		{
-			UE_LOG(LogHyperlink, Error, TEXT("Could not find registered definition with class %s"),
-				*ExecutePayload.Class->GetDisplayNameText().ToString()	);
+			UE_LOG(LogHyperlink, Error, TEXT("Could not find registered definition %s"),
+				bHasIdentifier ? *ExecutePayload.Identifier : *ExecutePayload.Class->GetDisplayNameText().ToString());
 		}
 	}
 	else
@@ -269,16 +949,175 @@ void UHyperlinkSubsystem::ExecuteLinkDeferred(const FHyperlinkExecutePayload Exe
 	}
 }
 
-/*static*/bool UHyperlinkSubsystem::TryGetPayloadFromString(const FString& InString, FHyperlinkExecutePayload& OutPayload)
+void UHyperlinkSubsystem::ExecuteBundleDeferred(const TArray<FHyperlinkExecutePayload>& Payloads)
 {
-	bool bResult{ false };
+	{
+		TGuardValue<bool> ExecutingBundleGuard{ bExecutingBundle, true };
+		for (const FHyperlinkExecutePayload& Payload : Payloads)
+		{
+			ExecuteLinkDeferred(Payload);
+		}
+	}
+
+	// Everything which needed the bundle's packages is now open, so they no longer need to be kept loaded
+	BundleLoadHandle.Reset();
+}
+
+void UHyperlinkSubsystem::DrainLinkInbox(float DeltaTime)
+{
+	LLM_SCOPE_BYTAG(Hyperlink);
+	ReleaseRetiredSnapshots();
 	
-	FRegexMatcher Matcher{ FRegexPattern(TEXT(R"(\{.*\}$)")), InString };
-	if (Matcher.FindNext())
+	if (LoadedBundle.IsSet())
 	{
-		bResult = FJsonObjectConverter::JsonObjectStringToUStruct(Matcher.GetCaptureGroup(0), &OutPayload);
+		const TArray<FHyperlinkExecutePayload> Payloads{ MoveTemp(LoadedBundle.GetValue()) };
+		LoadedBundle.Reset();
+		ExecuteBundleDeferred(Payloads);
 	}
 
-	return bResult;
+	if (const uint32 NumDropped{ LinkInbox->ConsumeNumDropped() })
+	{
+		INC_DWORD_STAT_BY(STAT_HyperlinkLinksDropped, NumDropped);
+		FHyperlinkMetrics::RecordDropped(NumDropped);
+		UE_LOG(LogHyperlink, Warning, TEXT("Dropped %u links, more than %d links were waiting to execute"),
+			NumDropped, LinkInbox->GetCapacity());
+	}
+
+	const double StartTime{ FPlatformTime::Seconds() };
+	{
+		// Forget links queued outside the window, QueueLink checks the time so this only bounds memory
+		FScopeLock Lock{ &RecentPayloadsLock };
+		for (auto It{ RecentPayloads.CreateIterator() }; It; ++It)
+		{
+			if (StartTime - It->Value >= FHyperlinkInboxConstants::CoalesceWindowSeconds)
+			{
+				It.RemoveCurrent();
+			}
+		}
+		
+		if (LinkInbox->IsEmpty() && NumCoalescedPayloads > 0)
+		{
+			UE_LOG(LogHyperlink, Display, TEXT("Skipped %d duplicate links"), NumCoalescedPayloads);
+			NumCoalescedPayloads = 0;
+		}
+	}
+
+	// Spread bursts of links over several frames rather than hitching the editor
+	const double EndTime{ StartTime + FHyperlinkInboxConstants::FrameBudgetSeconds };
+	int32 NumExecuted{ 0 };
+	FHyperlinkExecutePayload Payload{};
+	while ((NumExecuted == 0 || FPlatformTime::Seconds() < EndTime) && LinkInbox->Pop(Payload))
+	{
+		// Duplicates were already coalesced when queued
+		ExecuteLinkDeferred(Payload);
+		++NumExecuted;
+		INC_DWORD_STAT(STAT_HyperlinkLinksExecuted);
+	}
+
+	UpdateReceivingLink();
+}
+
+UHyperlinkDefinition* UHyperlinkSubsystem::FindPayloadDefinition(const FHyperlinkExecutePayload& ExecutePayload)
+{
+	UHyperlinkDefinition* Ret{ nullptr };
+	
+	// Prefer the identifier, the class is only present in links to unregistered classes or older links
+	if (!ExecutePayload.Identifier.IsEmpty())
+	{
+		Ret = LoadDefinition(ExecutePayload.Identifier);
+	}
+	else if (ExecutePayload.Class)
+	{
+		Ret = GetDefinition(ExecutePayload.Class);
+		InitializeDeferredDefinition(Ret);
+	}
+	return Ret;
+}
+
+EHyperlinkDecodeResult UHyperlinkSubsystem::DecodeLink(const FStringView InString,
+	const FHyperlinkDefinitionSnapshot& Snapshot, FHyperlinkLinkStore* const LinkStore,
+	FHyperlinkExecutePayload& OutPayload)
+{
+	HYPERLINK_SCOPE_CYCLE_COUNTER(STAT_HyperlinkDecodeLink);
+	LLM_SCOPE_BYTAG(Hyperlink);
+	
+	EHyperlinkDecodeResult Result{ EHyperlinkDecodeResult::Malformed };
+
+	// Only the last line can contain the payload, so skip anything before it without decoding e.g. a pasted log
+	FStringView LastLine{ InString };
+	while (LastLine.EndsWith(TEXT('\n')) || LastLine.EndsWith(TEXT('\r')))
+	{
+		LastLine.LeftChopInline(1);
+	}
+	for (int32 Idx{ LastLine.Len() - 1 }; Idx >= 0; --Idx)
+	{
+		if (LastLine[Idx] == TEXT('\n') || LastLine[Idx] == TEXT('\r'))
+		{
+			LastLine.RightChopInline(Idx + 1);
+			break;
+		}
+	}
+
+	// Replace any escaped characters, links are short enough to fit in the inline buffer
+	TStringBuilder<1024> ParsedString{};
+	FHyperlinkUtility::ParseUrlString(LastLine, ParsedString);
+
+	FStringView Hash{};
+	FStringView PayloadString{};
+	if (FHyperlinkLinkStore::TryFindHash(ParsedString.ToView(), Hash))
+	{
+		FString StoredPayloadString{};
+		if (LinkStore && LinkStore->TryResolve(Hash, StoredPayloadString))
+		{
+			if (FHyperlinkFormat::TryDeserializeExecutePayload(StoredPayloadString, OutPayload))
+			{
+				Result = EHyperlinkDecodeResult::Success;
+			}
+		}
+		else
+		{
+			Result = EHyperlinkDecodeResult::NotStored;
+		}
+	}
+	else if (FHyperlinkFormat::TryFindPayloadString(ParsedString.ToView(), PayloadString)
+		&& FHyperlinkFormat::TryDeserializeExecutePayload(PayloadString, OutPayload))
+	{
+		Result = EHyperlinkDecodeResult::Success;
+	}
+
+	if (Result == EHyperlinkDecodeResult::Success)
+	{
+		// Prefer the identifier, the class is only present in links to unregistered classes or older links
+		const FHyperlinkDefinitionSnapshot::FEntry* const Entry{ !OutPayload.Identifier.IsEmpty()
+			? Snapshot.FindByIdentifier(OutPayload.Identifier) : Snapshot.FindByClass(OutPayload.Class) };
+		if (!Entry)
+		{
+			Result = EHyperlinkDecodeResult::UnknownDefinition;
+		}
+		else if (!OutPayload.DefinitionPayload.JsonString.IsEmpty())
+		{
+			// Catch links to deleted or renamed assets before they reach the game thread. The default object can't be
+			// collected while it's in use
+			TArray<FName> PackageNames{};
+			{
+				FGCScopeGuard GCGuard{};
+				if (const UHyperlinkDefinition* const DefaultObject{ Entry->DefaultObject.Get() })
+				{
+					DefaultObject->GetPayloadDependencies(OutPayload.DefinitionPayload.JsonString, PackageNames);
+				}
+			}
+			for (const FName& PackageName : PackageNames)
+			{
+				if (!FHyperlinkSubsystemHelpers::DoesPackageExist(PackageName))
+				{
+					UE_LOG(LogHyperlink, Warning, TEXT("Link opens %s which doesn't exist"), *PackageName.ToString());
+					Result = EHyperlinkDecodeResult::MissingAsset;
+					break;
+				}
+			}
+		}
+	}
+
+	return Result;
 }
 #endif //WITH_EDITOR
@@ -3,16 +3,38 @@
 
 #include "HyperlinkUtility.h"
 
+#include "Containers/LruCache.h"
+#include "Hash/xxhash.h"
 #include "HyperlinkDefinition.h"
 #include "HyperlinkExecutePayload.h"
-#include "HyperlinkPythonBridge.h"
+#include "HyperlinkFormat.h"
+#include "HyperlinkLinkStore.h"
 #include "HyperlinkSettings.h"
-#include "Internationalization/Regex.h"
+#include "HyperlinkStats.h"
+#include "HyperlinkSubsystem.h"
 #include "JsonObjectConverter.h"
+#include "Misc/ScopeLock.h"
+#include "Misc/StringBuilder.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Serialization/JsonSerializer.h"
+#include "UObject/ObjectKey.h"
+
+#if PLATFORM_CPU_X86_FAMILY
+#include <emmintrin.h>
+#define HYPERLINK_URL_CODEC_SSE2 1
+#elif PLATFORM_CPU_ARM_FAMILY && PLATFORM_ENABLE_VECTORINTRINSICS_NEON && PLATFORM_64BITS
+#include <arm_neon.h>
+#define HYPERLINK_URL_CODEC_NEON 1
+#endif
 
 #if WITH_EDITOR
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Engine/Blueprint.h"
+#include "Framework/Notifications/NotificationManager.h"
 #include "LogHyperlink.h"
+#include "Misc/PackageName.h"
 #include "Styling/StarshipCoreStyle.h"
+#include "Widgets/Notifications/SNotificationList.h"
 
 namespace FHyperlinkUtilityConstants
 {
@@ -20,13 +42,349 @@ namespace FHyperlinkUtilityConstants
 }
 #endif //WITH_EDITOR
 
+/* Finished links for recently used payloads, so copying the same link repeatedly only has to generate the payload */
+namespace FHyperlinkLinkCache
+{
+	static constexpr int32 MaxEntries{ 128 };
+	
+	struct FKey
+	{
+		FObjectKey Class{};
+		uint64 PayloadHash{ 0 };
+
+		bool operator==(const FKey& Other) const
+		{
+			return Class == Other.Class && PayloadHash == Other.PayloadHash;
+		}
+		
+		friend uint32 GetTypeHash(const FKey& Key)
+		{
+			return HashCombineFast(GetTypeHash(Key.Class), GetTypeHash(Key.PayloadHash));
+		}
+	};
+
+	struct FEntry
+	{
+		/* Compared on lookup to rule out hash collisions */
+		FString PayloadString{};
+		FString Link{};
+		/* Hash of the payload in the link store if the link is to a stored payload, touched on each hit */
+		FString StoreHash{};
+	};
+
+	static FCriticalSection CriticalSection{};
+	static TLruCache<FKey, FEntry> Links{ MaxEntries };
+	static FString BaseAddress{};
+	static uint64 NumHits{ 0 };
+	static uint64 NumMisses{ 0 };
+}
+
+/* Helpers for the native URL codec. Behaviour mirrors python's urllib.parse.quote/unquote */
+namespace FHyperlinkUrlCodec
+{
+	static constexpr TCHAR HexDigits[]{ TEXT("0123456789ABCDEF") };
+	static constexpr uint32 ReplacementCodePoint{ 0xFFFD };
+	
+	/* Lookup table of the ASCII characters which are not escaped: RFC 3986 unreserved characters plus '/' */
+	struct FUnreservedTable
+	{
+		constexpr FUnreservedTable()
+			: bUnreserved{}
+		{
+			for (int32 Char{ 'A' }; Char <= 'Z'; ++Char)
+			{
+				bUnreserved[Char] = true;
+				bUnreserved[Char - 'A' + 'a'] = true;
+			}
+			for (int32 Char{ '0' }; Char <= '9'; ++Char)
+			{
+				bUnreserved[Char] = true;
+			}
+			bUnreserved['-'] = true;
+			bUnreserved['.'] = true;
+			bUnreserved['/'] = true;
+			bUnreserved['_'] = true;
+			bUnreserved['~'] = true;
+		}
+
+		bool bUnreserved[128];
+	};
+	static constexpr FUnreservedTable UnreservedTable{};
+
+	static bool IsUnreserved(const TCHAR Char)
+	{
+		return static_cast<uint32>(Char) < 128 && UnreservedTable.bUnreserved[Char];
+	}
+
+	/* Get the number of characters at the start of the string which don't need escaping */
+	static int32 GetUnreservedRunLength(const TCHAR* const Data, const int32 Num)
+	{
+		int32 Count{ 0 };
+
+#if HYPERLINK_URL_CODEC_SSE2 || HYPERLINK_URL_CODEC_NEON
+		// Vectorised path tests 8 UTF-16 characters at a time
+		if constexpr (sizeof(TCHAR) == sizeof(uint16))
+		{
+#if HYPERLINK_URL_CODEC_SSE2
+			// a <= x <= a + n (unsigned) is tested as saturate(x - a - n) == 0
+			const auto InRange = [](const __m128i Chars, const uint16 First, const uint16 Last)
+			{
+				const __m128i Offset{ _mm_sub_epi16(Chars, _mm_set1_epi16(static_cast<int16>(First))) };
+				return _mm_cmpeq_epi16(_mm_subs_epu16(Offset, _mm_set1_epi16(static_cast<int16>(Last - First))),
+					_mm_setzero_si128());
+			};
+
+			while (Count + 8 <= Num)
+			{
+				const __m128i Chars{ _mm_loadu_si128(reinterpret_cast<const __m128i*>(Data + Count)) };
+				// Setting bit 0x20 maps upper case letters to lower case so a single range check covers both
+				const __m128i Letters{ InRange(_mm_or_si128(Chars, _mm_set1_epi16(0x20)), 'a', 'z') };
+				const __m128i Digits{ InRange(Chars, '0', '9') };
+				const __m128i Symbols{ InRange(Chars, '-', '/') }; // '-', '.' and '/'
+				const __m128i Underscores{ _mm_cmpeq_epi16(Chars, _mm_set1_epi16('_')) };
+				const __m128i Tildes{ _mm_cmpeq_epi16(Chars, _mm_set1_epi16('~')) };
+				
+				const __m128i Mask{ _mm_or_si128(_mm_or_si128(Letters, Digits),
+					_mm_or_si128(Symbols, _mm_or_si128(Underscores, Tildes))) };
+				const uint32 Bits{ static_cast<uint32>(_mm_movemask_epi8(Mask)) };
+				if (Bits != 0xFFFF)
+				{
+					// Each character contributes 2 bits to the mask
+					return Count + static_cast<int32>(FMath::CountTrailingZeros(~Bits)) / 2;
+				}
+				Count += 8;
+			}
+#elif HYPERLINK_URL_CODEC_NEON
+			const auto InRange = [](const uint16x8_t Chars, const uint16 First, const uint16 Last)
+			{
+				return vcleq_u16(vsubq_u16(Chars, vdupq_n_u16(First)), vdupq_n_u16(Last - First));
+			};
+
+			while (Count + 8 <= Num)
+			{
+				const uint16x8_t Chars{ vld1q_u16(reinterpret_cast<const uint16*>(Data + Count)) };
+				// Setting bit 0x20 maps upper case letters to lower case so a single range check covers both
+				const uint16x8_t Letters{ InRange(vorrq_u16(Chars, vdupq_n_u16(0x20)), 'a', 'z') };
+				const uint16x8_t Digits{ InRange(Chars, '0', '9') };
+				const uint16x8_t Symbols{ InRange(Chars, '-', '/') }; // '-', '.' and '/'
+				const uint16x8_t Underscores{ vceqq_u16(Chars, vdupq_n_u16('_')) };
+				const uint16x8_t Tildes{ vceqq_u16(Chars, vdupq_n_u16('~')) };
+
+				const uint16x8_t Mask{ vorrq_u16(vorrq_u16(Letters, Digits),
+					vorrq_u16(Symbols, vorrq_u16(Underscores, Tildes))) };
+				// Narrow each 16 bit lane to 8 bits so the mask fits in a single 64 bit value
+				const uint64 Bits{ vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(Mask, 4)), 0) };
+				if (Bits != ~0ull)
+				{
+					return Count + static_cast<int32>(FMath::CountTrailingZeros64(~Bits)) / 8;
+				}
+				Count += 8;
+			}
+#endif
+		}
+#endif //HYPERLINK_URL_CODEC_SSE2 || HYPERLINK_URL_CODEC_NEON
+
+		while (Count < Num && IsUnreserved(Data[Count]))
+		{
+			++Count;
+		}
+		
+		return Count;
+	}
+
+	/* Read the code point at Idx, combining surrogate pairs. Lone surrogates are replaced with U+FFFD */
+	static uint32 ReadCodePoint(const TCHAR* const Data, const int32 Num, int32& Idx)
+	{
+		uint32 CodePoint{ static_cast<uint32>(Data[Idx++]) };
+		
+		if (CodePoint >= 0xD800 && CodePoint <= 0xDBFF)
+		{
+			const uint32 LowSurrogate{ Idx < Num ? static_cast<uint32>(Data[Idx]) : 0 };
+			if (LowSurrogate >= 0xDC00 && LowSurrogate <= 0xDFFF)
+			{
+				CodePoint = 0x10000 + ((CodePoint - 0xD800) << 10) + (LowSurrogate - 0xDC00);
+				++Idx;
+			}
+			else
+			{
+				CodePoint = ReplacementCodePoint;
+			}
+		}
+		else if (CodePoint >= 0xDC00 && CodePoint <= 0xDFFF)
+		{
+			CodePoint = ReplacementCodePoint;
+		}
+		
+		return CodePoint;
+	}
+
+	/* Write a code point as UTF-8, returns the number of bytes written */
+	static int32 EncodeUtf8(const uint32 CodePoint, uint8 (&OutBytes)[4])
+	{
+		int32 NumBytes{ 0 };
+		
+		if (CodePoint < 0x80)
+		{
+			OutBytes[0] = static_cast<uint8>(CodePoint);
+			NumBytes = 1;
+		}
+		else if (CodePoint < 0x800)
+		{
+			OutBytes[0] = static_cast<uint8>(0xC0 | (CodePoint >> 6));
+			OutBytes[1] = static_cast<uint8>(0x80 | (CodePoint & 0x3F));
+			NumBytes = 2;
+		}
+		else if (CodePoint < 0x10000)
+		{
+			OutBytes[0] = static_cast<uint8>(0xE0 | (CodePoint >> 12));
+			OutBytes[1] = static_cast<uint8>(0x80 | ((CodePoint >> 6) & 0x3F));
+			OutBytes[2] = static_cast<uint8>(0x80 | (CodePoint & 0x3F));
+			NumBytes = 3;
+		}
+		else
+		{
+			OutBytes[0] = static_cast<uint8>(0xF0 | (CodePoint >> 18));
+			OutBytes[1] = static_cast<uint8>(0x80 | ((CodePoint >> 12) & 0x3F));
+			OutBytes[2] = static_cast<uint8>(0x80 | ((CodePoint >> 6) & 0x3F));
+			OutBytes[3] = static_cast<uint8>(0x80 | (CodePoint & 0x3F));
+			NumBytes = 4;
+		}
+		
+		return NumBytes;
+	}
+
+	static int32 GetHexValue(const TCHAR Char)
+	{
+		int32 Value{ -1 };
+		
+		if (Char >= TEXT('0') && Char <= TEXT('9'))
+		{
+			Value = Char - TEXT('0');
+		}
+		else if (Char >= TEXT('A') && Char <= TEXT('F'))
+		{
+			Value = Char - TEXT('A') + 10;
+		}
+		else if (Char >= TEXT('a') && Char <= TEXT('f'))
+		{
+			Value = Char - TEXT('a') + 10;
+		}
+		
+		return Value;
+	}
+
+	static void AppendCodePoint(const uint32 CodePoint, FStringBuilderBase& OutBuilder)
+	{
+		if (sizeof(TCHAR) == sizeof(uint16) && CodePoint >= 0x10000)
+		{
+			OutBuilder.AppendChar(static_cast<TCHAR>(0xD800 + ((CodePoint - 0x10000) >> 10)));
+			OutBuilder.AppendChar(static_cast<TCHAR>(0xDC00 + ((CodePoint - 0x10000) & 0x3FF)));
+		}
+		else
+		{
+			OutBuilder.AppendChar(static_cast<TCHAR>(CodePoint));
+		}
+	}
+
+	/*
+	 * Decode UTF-8 bytes, replacing each maximal invalid subsequence with U+FFFD. This is the same replacement
+	 * behaviour as python's bytes.decode("utf-8", "replace") which is used by urllib.parse.unquote
+	 */
+	static void DecodeUtf8(const TConstArrayView<uint8> Bytes, FStringBuilderBase& OutBuilder)
+	{
+		int32 Idx{ 0 };
+		while (Idx < Bytes.Num())
+		{
+			const uint8 Lead{ Bytes[Idx++] };
+			if (Lead < 0x80)
+			{
+				OutBuilder.AppendChar(static_cast<TCHAR>(Lead));
+				continue;
+			}
+
+			// Valid range of the second byte depends on the lead byte to reject overlong and surrogate encodings
+			int32 NumContinuation{ 0 };
+			uint8 SecondMin{ 0x80 };
+			uint8 SecondMax{ 0xBF };
+			uint32 CodePoint{ 0 };
+			if (Lead >= 0xC2 && Lead <= 0xDF)
+			{
+				NumContinuation = 1;
+				CodePoint = Lead & 0x1F;
+			}
+			else if (Lead >= 0xE0 && Lead <= 0xEF)
+			{
+				NumContinuation = 2;
+				SecondMin = Lead == 0xE0 ? 0xA0 : 0x80;
+				SecondMax = Lead == 0xED ? 0x9F : 0xBF;
+				CodePoint = Lead & 0x0F;
+			}
+			else if (Lead >= 0xF0 && Lead <= 0xF4)
+			{
+				NumContinuation = 3;
+				SecondMin = Lead == 0xF0 ? 0x90 : 0x80;
+				SecondMax = Lead == 0xF4 ? 0x8F : 0xBF;
+				CodePoint = Lead & 0x07;
+			}
+
+			bool bValid{ NumContinuation > 0 };
+			for (int32 ContinuationIdx{ 0 }; bValid && ContinuationIdx < NumContinuation; ++ContinuationIdx)
+			{
+				const uint8 Min{ ContinuationIdx == 0 ? SecondMin : static_cast<uint8>(0x80) };
+				const uint8 Max{ ContinuationIdx == 0 ? SecondMax : static_cast<uint8>(0xBF) };
+				if (Idx < Bytes.Num() && Bytes[Idx] >= Min && Bytes[Idx] <= Max)
+				{
+					CodePoint = (CodePoint << 6) | (Bytes[Idx] & 0x3F);
+					++Idx;
+				}
+				else
+				{
+					// The invalid byte isn't consumed so it can start the next sequence
+					bValid = false;
+				}
+			}
+			
+			AppendCodePoint(bValid ? CodePoint : ReplacementCodePoint, OutBuilder);
+		}
+	}
+}
+
 #define LOCTEXT_NAMESPACE "Hyperlink"
 
 FString FHyperlinkUtility::GetLinkBaseAddress()
 {
-	const UHyperlinkSettings* const Settings{ GetDefault<UHyperlinkSettings>() };
-	return FString::Printf(TEXT("http://localhost:%d/%s"),
-		Settings->GetLocalServerPort(), *Settings->GetProjectIdentifier());
+	FScopeLock Lock{ &FHyperlinkLinkCache::CriticalSection };
+	if (FHyperlinkLinkCache::BaseAddress.IsEmpty())
+	{
+		const UHyperlinkSettings* const Settings{ GetDefault<UHyperlinkSettings>() };
+		FHyperlinkLinkCache::BaseAddress = FString::Printf(TEXT("http://localhost:%d/%s"),
+			Settings->GetLocalServerPort(), *Settings->GetProjectIdentifier());
+	}
+	return FHyperlinkLinkCache::BaseAddress;
+}
+
+void FHyperlinkUtility::ResetLinkBaseAddress()
+{
+	FScopeLock Lock{ &FHyperlinkLinkCache::CriticalSection };
+	FHyperlinkLinkCache::BaseAddress.Reset();
+	// Cached links contain the base address
+	FHyperlinkLinkCache::Links.Empty(FHyperlinkLinkCache::MaxEntries);
+}
+
+void FHyperlinkUtility::ResetLinkCache()
+{
+	FScopeLock Lock{ &FHyperlinkLinkCache::CriticalSection };
+	FHyperlinkLinkCache::Links.Empty(FHyperlinkLinkCache::MaxEntries);
+}
+
+FHyperlinkUtility::FLinkCacheStats FHyperlinkUtility::GetLinkCacheStats()
+{
+	FScopeLock Lock{ &FHyperlinkLinkCache::CriticalSection };
+	FLinkCacheStats Stats{};
+	Stats.NumHits = FHyperlinkLinkCache::NumHits;
+	Stats.NumMisses = FHyperlinkLinkCache::NumMisses;
+	Stats.NumEntries = FHyperlinkLinkCache::Links.Num();
+	return Stats;
 }
 
 FString FHyperlinkUtility::GetLinkStructureHint()
@@ -37,81 +395,224 @@ FString FHyperlinkUtility::GetLinkStructureHint()
 FString FHyperlinkUtility::CreateLinkFromPayload(const TSubclassOf<UHyperlinkDefinition> DefinitionClass,
                                                  const TSharedRef<FJsonObject>& InPayload)
 {
+	// Write the payload as a string so both overloads share the link cache
 	FString PayloadString{};
+	const TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> JsonWriter
+		{ TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&PayloadString) };
+	FJsonSerializer::Serialize(InPayload, JsonWriter);
+	return CreateLinkFromPayload(DefinitionClass, PayloadString);
+}
+
+FString FHyperlinkUtility::CreateLinkFromPayload(const TSubclassOf<UHyperlinkDefinition> DefinitionClass,
+                                                 const FStringView InPayloadString)
+{
+	HYPERLINK_SCOPE_CYCLE_COUNTER(STAT_HyperlinkCreateLink);
+	LLM_SCOPE_BYTAG(Hyperlink);
+	
+	const FHyperlinkLinkCache::FKey Key
+	{
+		FObjectKey(DefinitionClass.Get()),
+		FXxHash64::HashBuffer(InPayloadString.GetData(), InPayloadString.Len() * sizeof(TCHAR)).Hash
+	};
+
+	FString Link{};
+	FString StoreHash{};
+	{
+		FScopeLock Lock{ &FHyperlinkLinkCache::CriticalSection };
+		const FHyperlinkLinkCache::FEntry* const Entry{ FHyperlinkLinkCache::Links.FindAndTouch(Key) };
+		if (Entry && FStringView(Entry->PayloadString).Equals(InPayloadString, ESearchCase::CaseSensitive))
+		{
+			Link = Entry->Link;
+			StoreHash = Entry->StoreHash;
+		}
+	}
+
+	// Cached links to stored payloads have to keep the payload in the store for as long as they're handed out
+	if (!StoreHash.IsEmpty())
+	{
+		const UHyperlinkSubsystem* const Subsystem
+			{ GEngine ? GEngine->GetEngineSubsystem<UHyperlinkSubsystem>() : nullptr };
+		FHyperlinkLinkStore* const LinkStore{ Subsystem ? Subsystem->GetLinkStore() : nullptr };
+		if (!LinkStore || !LinkStore->Touch(StoreHash))
+		{
+			Link.Reset();
+		}
+	}
+
+	if (!Link.IsEmpty())
+	{
+		// Only counted once the link is known to be usable, a stored payload which has expired is a miss
+		FScopeLock Lock{ &FHyperlinkLinkCache::CriticalSection };
+		++FHyperlinkLinkCache::NumHits;
+	}
+	else
+	{
+		const FString PayloadString{ InPayloadString };
+		TArray<FString> Links{ CreateLinksFromPayloads(DefinitionClass, MakeArrayView(&PayloadString, 1)) };
+		if (Links.Num() > 0)
+		{
+			Link = MoveTemp(Links[0]);
+		}
+
+		FScopeLock Lock{ &FHyperlinkLinkCache::CriticalSection };
+		++FHyperlinkLinkCache::NumMisses;
+		if (!Link.IsEmpty())
+		{
+			FStringView Hash{};
+			FHyperlinkLinkCache::Links.Add(Key, FHyperlinkLinkCache::FEntry{ PayloadString, Link,
+				FHyperlinkLinkStore::TryFindHash(Link, Hash) ? FString(Hash) : FString() });
+		}
+	}
+	
+	return Link;
+}
+
+TArray<FString> FHyperlinkUtility::CreateLinksFromPayloads(const TSubclassOf<UHyperlinkDefinition> DefinitionClass,
+	const TConstArrayView<FString> InPayloadStrings)
+{
+	TArray<FString> Links{};
+	
 	if (DefinitionClass)
 	{
-		// Create execute payload
+		// Everything other than the payload is the same for each link so only look it up once
 		FHyperlinkExecutePayload ExecutePayload{};
+		
+		// Use the short identifier if the definition is registered, otherwise fall back to the class path
+		const UHyperlinkSubsystem* const Subsystem{ GEngine ? GEngine->GetEngineSubsystem<UHyperlinkSubsystem>() : nullptr };
+		ExecutePayload.Identifier = Subsystem ? Subsystem->FindIdentifier(DefinitionClass) : FString();
+		if (ExecutePayload.Identifier.IsEmpty())
 		{
 			ExecutePayload.Class = DefinitionClass;
-			
-			FJsonObjectWrapper ObjectWrapper{};
-			ObjectWrapper.JsonObject = InPayload.ToSharedPtr();
-			ExecutePayload.DefinitionPayload = MoveTemp(ObjectWrapper);
 		}
 		
-		FJsonObjectConverter::UStructToJsonObjectString(ExecutePayload, PayloadString, 0, 0, 0, nullptr, false);
+		const UHyperlinkSettings* const Settings{ GetDefault<UHyperlinkSettings>() };
+		const EHyperlinkLinkFormat Format{ Settings->GetLinkFormat() };
+		const int32 MaxPayloadLength{ Settings->GetMaxLinkPayloadLength() };
+		FHyperlinkLinkStore* const LinkStore{ Subsystem ? Subsystem->GetLinkStore() : nullptr };
 
-		// Escape any special characters in the URL
-#if WITH_EDITOR
-		// Use the more complete python version of the function if we're in the editor
-		if (GEditor)
+		// Each link is built in the same buffer after the base address
+		TStringBuilder<1024> LinkBuilder{};
+		LinkBuilder << GetLinkBaseAddress() << TEXT('/');
+		const int32 PayloadStart{ LinkBuilder.Len() };
+		
+		Links.Reserve(InPayloadStrings.Num());
+		for (const FString& PayloadString : InPayloadStrings)
 		{
-			PayloadString = UHyperlinkPythonBridge::GetChecked().EscapeUrlString(PayloadString);
+			ExecutePayload.DefinitionPayload.JsonString = PayloadString;
+			const FString SerializedPayload{ FHyperlinkFormat::SerializeExecutePayload(ExecutePayload, Format) };
+
+			// Escape any special characters in the URL
+			LinkBuilder.RemoveSuffix(LinkBuilder.Len() - PayloadStart);
+			EscapeUrlString(SerializedPayload, LinkBuilder);
+
+			// Payloads too long for a URL are saved to the link store and the link contains just the hash
+			if (LinkStore && LinkBuilder.Len() - PayloadStart > MaxPayloadLength)
+			{
+				const FString Hash{ LinkStore->Store(SerializedPayload) };
+				if (!Hash.IsEmpty())
+				{
+					LinkBuilder.RemoveSuffix(LinkBuilder.Len() - PayloadStart);
+					LinkBuilder << FHyperlinkLinkStore::LinkPathSegment << TEXT('/') << Hash;
+				}
+			}
+			
+			Links.Emplace(LinkBuilder.ToView());
 		}
-		else
-#endif //WITH_EDITOR
+	}
+	
+	return Links;
+}
+
+FString FHyperlinkUtility::EscapeUrlString(const FStringView InString)
+{
+	TStringBuilder<512> Builder{};
+	EscapeUrlString(InString, Builder);
+	return FString(Builder.ToView());
+}
+
+void FHyperlinkUtility::EscapeUrlString(const FStringView InString, FStringBuilderBase& OutBuilder)
+{
+	const TCHAR* const Data{ InString.GetData() };
+	const int32 Num{ InString.Len() };
+
+	int32 Idx{ 0 };
+	while (Idx < Num)
+	{
+		// Copy runs of characters which don't need escaping in one go
+		const int32 RunLength{ FHyperlinkUrlCodec::GetUnreservedRunLength(Data + Idx, Num - Idx) };
+		OutBuilder.Append(Data + Idx, RunLength);
+		Idx += RunLength;
+
+		if (Idx < Num)
 		{
-			// Escape code here
-			PayloadString = FHyperlinkUtility::EscapeUrlString(PayloadString);
+			// Escape the UTF-8 bytes of the next code point
+			uint8 Utf8Bytes[4];
+			const int32 NumBytes{ FHyperlinkUrlCodec::EncodeUtf8(FHyperlinkUrlCodec::ReadCodePoint(Data, Num, Idx),
+				Utf8Bytes) };
+			for (int32 ByteIdx{ 0 }; ByteIdx < NumBytes; ++ByteIdx)
+			{
+				OutBuilder.AppendChar(TEXT('%'));
+				OutBuilder.AppendChar(FHyperlinkUrlCodec::HexDigits[Utf8Bytes[ByteIdx] >> 4]);
+				OutBuilder.AppendChar(FHyperlinkUrlCodec::HexDigits[Utf8Bytes[ByteIdx] & 0xF]);
+			}
 		}
 	}
+}
+
+FString FHyperlinkUtility::ParseUrlString(const FStringView InString)
+{
+	TStringBuilder<512> Builder{};
+	ParseUrlString(InString, Builder);
+	return FString(Builder.ToView());
+}
+
+void FHyperlinkUtility::ParseUrlString(const FStringView InString, FStringBuilderBase& OutBuilder)
+{
+	HYPERLINK_SCOPE_CYCLE_COUNTER(STAT_HyperlinkUrlDecode);
 	
-	return GetLinkBaseAddress() / PayloadString;
-}
-
-FString FHyperlinkUtility::EscapeUrlString(const FString& InString)
-{
-	// Map of char to the URL encoded equivalent.
-	static const TCHAR* CharEncodingMap[][2] 
-	{
-		// Always replace "%" first to avoid double-encoding characters
-		{ TEXT("%"), TEXT("%25") },
-		{ TEXT(" "), TEXT("%20") },
-		{ TEXT("!"), TEXT("%21") },
-		{ TEXT("\""), TEXT("%22") },
-		{ TEXT("#"), TEXT("%23") },
-		{ TEXT("$"), TEXT("%24") },
-		{ TEXT("&"), TEXT("%26") },
-		{ TEXT("'"), TEXT("%27") },
-		{ TEXT("("), TEXT("%28") },
-		{ TEXT(")"), TEXT("%29") },
-		{ TEXT("*"), TEXT("%2A") },
-		{ TEXT("+"), TEXT("%2B") },
-		{ TEXT(","), TEXT("%2C") },
-		{ TEXT(":"), TEXT("%3A") },
-		{ TEXT(";"), TEXT("%3B") },
-		{ TEXT("="), TEXT("%3D") },
-		{ TEXT("?"), TEXT("%3F") },
-		{ TEXT("["), TEXT("%5B") },
-		{ TEXT("]"), TEXT("%5D") },
-		{ TEXT("@"), TEXT("%40") },
-		{ TEXT("{"), TEXT("%7B") },
-		{ TEXT("}"), TEXT("%7D") },
-		{ TEXT("~"), TEXT("%7E") },
-	};
+	const TCHAR* const Data{ InString.GetData() };
+	const int32 Num{ InString.Len() };
 
-	FString EscapedString{ InString };
+	// Escaped bytes are collected so that multi-byte UTF-8 sequences can be decoded together
+	TArray<uint8, TInlineAllocator<64>> EscapedBytes{};
 
-	for (int32 Idx { 0 }; Idx < GetNum(CharEncodingMap); ++Idx )
+	int32 Idx{ 0 };
+	while (Idx < Num)
 	{
-		const TCHAR* const OriginalChar{ CharEncodingMap[Idx][0] };
-		const TCHAR* const EscapedChar{ CharEncodingMap[Idx][1] };
-		// Use ReplaceInline as that won't create a copy of the string if the character isn't found
-		EscapedString.ReplaceInline(OriginalChar, EscapedChar, ESearchCase::CaseSensitive);
-	}
+		// Copy everything up to the next escape sequence in one go
+		int32 RunEnd{ Idx };
+		while (RunEnd < Num && Data[RunEnd] != TEXT('%'))
+		{
+			++RunEnd;
+		}
+		OutBuilder.Append(Data + Idx, RunEnd - Idx);
+		Idx = RunEnd;
 
-	return EscapedString;
+		// Collect consecutive escape sequences
+		EscapedBytes.Reset();
+		while (Idx + 2 < Num)
+		{
+			const int32 High{ FHyperlinkUrlCodec::GetHexValue(Data[Idx + 1]) };
+			const int32 Low{ FHyperlinkUrlCodec::GetHexValue(Data[Idx + 2]) };
+			if (Data[Idx] != TEXT('%') || High < 0 || Low < 0)
+			{
+				break;
+			}
+			EscapedBytes.Add(static_cast<uint8>((High << 4) | Low));
+			Idx += 3;
+		}
+
+		if (EscapedBytes.Num() > 0)
+		{
+			FHyperlinkUrlCodec::DecodeUtf8(EscapedBytes, OutBuilder);
+		}
+		else if (Idx < Num)
+		{
+			// Not a valid escape sequence, keep the '%' as it is
+			OutBuilder.AppendChar(Data[Idx]);
+			++Idx;
+		}
+	}
 }
 
 #if WITH_EDITOR
@@ -243,8 +744,127 @@ TSharedRef<FExtender> FHyperlinkUtility::GetMenuExtender(const FName& ExtensionH
 	return Extender;
 }
 
+/* Async loads started by links. A new link supersedes them, the links of a bundle load alongside each other */
+namespace FHyperlinkAsyncLoad
+{
+	/* Dependencies are requested at a higher priority so they're ready by the time the asset itself is serialized */
+	static constexpr TAsyncLoadPriority DependencyPriority{ 100 };
+	static constexpr TAsyncLoadPriority AssetPriority{ 50 };
+	
+	struct FPendingLoad
+	{
+		uint32 Serial{ 0 };
+		FString PackageName{};
+		TFunction<void(UObject*)> OnLoaded{};
+		int32 NumRequests{ 0 };
+		int32 NumCompleted{ 0 };
+		double StartTime{ 0.0 };
+		TWeakPtr<SNotificationItem> Notification{};
+	};
+
+	/*
+	 * Kept until OnLoaded has been called, so loads which have finished loading but are waiting for the end of the
+	 * tick can still be cancelled
+	 */
+	static TArray<FPendingLoad> PendingLoads{};
+	static uint32 LastSerial{ 0 };
+
+	static FPendingLoad* FindPendingLoad(const uint32 Serial)
+	{
+		return PendingLoads.FindByPredicate([Serial](const FPendingLoad& Load) { return Load.Serial == Serial; });
+	}
+
+	static FText GetProgressText(const FPendingLoad& Load)
+	{
+		return FText::Format(LOCTEXT("AsyncLoadProgress", "Loading {0} ({1}/{2} packages)"),
+			FText::FromString(FPackageName::GetShortName(Load.PackageName)), Load.NumCompleted, Load.NumRequests);
+	}
+
+	static void FinishNotification(const FPendingLoad& Load, const bool bSuccess, const FText& Text)
+	{
+		if (const TSharedPtr<SNotificationItem> Notification{ Load.Notification.Pin() })
+		{
+			Notification->SetText(Text);
+			Notification->SetCompletionState(bSuccess ? SNotificationItem::CS_Success : SNotificationItem::CS_Fail);
+			Notification->ExpireAndFadeout();
+		}
+	}
+
+	/* Async loads complete part way through the tick where opening some assets (e.g. levels) isn't safe */
+	static void CallOnPostEditorTick(TFunction<void()> Function)
+	{
+		const TSharedRef<FDelegateHandle> Handle{ MakeShared<FDelegateHandle>() };
+		*Handle = GEngine->OnPostEditorTick().AddLambda([Handle, Function = MoveTemp(Function)](float DeltaTime) mutable
+		{
+			// Removing the delegate destroys this lambda so take what we need first
+			const FDelegateHandle LocalHandle{ *Handle };
+			const TFunction<void()> DeferredFunction{ MoveTemp(Function) };
+			GEngine->OnPostEditorTick().Remove(LocalHandle);
+			DeferredFunction();
+		});
+	}
+
+	static void CancelLoad(const uint32 Serial)
+	{
+		if (const FPendingLoad* const Load{ FindPendingLoad(Serial) })
+		{
+			// Requested packages can't be cancelled individually so they continue loading in the background, but
+			// nothing will be opened when they finish
+			UE_LOG(LogHyperlink, Display, TEXT("Cancelled loading %s"), *Load->PackageName);
+			FinishNotification(*Load, false, FText::Format(LOCTEXT("AsyncLoadCancelled", "Cancelled loading {0}"),
+				FText::FromString(FPackageName::GetShortName(Load->PackageName))));
+			PendingLoads.RemoveAll([Serial](const FPendingLoad& Other) { return Other.Serial == Serial; });
+		}
+	}
+
+	static void OnPackageLoaded(const FName& PackageName, UPackage* const LoadedPackage,
+		const EAsyncLoadingResult::Type Result, const uint32 Serial)
+	{
+		// Ignore packages requested by a load which has since been cancelled or superseded
+		FPendingLoad* const Load{ FindPendingLoad(Serial) };
+		if (Load && Load->NumCompleted < Load->NumRequests)
+		{
+			++Load->NumCompleted;
+			UE_CLOG(Result != EAsyncLoadingResult::Succeeded, LogHyperlink, Warning, TEXT("Failed to async load %s"),
+				*PackageName.ToString());
+
+			if (Load->NumCompleted < Load->NumRequests)
+			{
+				if (const TSharedPtr<SNotificationItem> Notification{ Load->Notification.Pin() })
+				{
+					Notification->SetText(GetProgressText(*Load));
+				}
+			}
+			else
+			{
+				CallOnPostEditorTick([Serial]()
+				{
+					if (FPendingLoad* const PendingLoad{ FindPendingLoad(Serial) })
+					{
+						const FPendingLoad FinishedLoad{ MoveTemp(*PendingLoad) };
+						PendingLoads.RemoveAll([Serial](const FPendingLoad& Other) { return Other.Serial == Serial; });
+						
+						// Everything is in memory now so this only has to find the asset
+						UObject* const Object{ FHyperlinkUtility::LoadObject(FinishedLoad.PackageName) };
+						UE_LOG(LogHyperlink, Display, TEXT("Loaded %s and %d dependencies in %.1fms"),
+							*FinishedLoad.PackageName, FinishedLoad.NumRequests - 1,
+							(FPlatformTime::Seconds() - FinishedLoad.StartTime) * 1000.0);
+						FinishNotification(FinishedLoad, Object != nullptr, FText::Format(Object
+								? LOCTEXT("AsyncLoadSucceeded", "Loaded {0}")
+								: LOCTEXT("AsyncLoadFailed", "Failed to load {0}"),
+							FText::FromString(FPackageName::GetShortName(FinishedLoad.PackageName))));
+						FinishedLoad.OnLoaded(Object);
+					}
+				});
+			}
+		}
+	}
+}
+
 UObject* FHyperlinkUtility::LoadObject(const FString& PackageName)
 {
+	HYPERLINK_SCOPE_CYCLE_COUNTER(STAT_HyperlinkPackageLoad);
+	
 	UObject* Ret{ nullptr };
 	
 	if (UPackage* const Package{ LoadPackage(nullptr, *PackageName, LOAD_NoRedirects) })
@@ -259,9 +879,103 @@ UObject* FHyperlinkUtility::LoadObject(const FString& PackageName)
 	return Ret;
 }
 
+void FHyperlinkUtility::LoadObjectAsync(const FString& PackageName, TFunction<void(UObject*)> OnLoaded)
+{
+	using namespace FHyperlinkAsyncLoad;
+	
+	// A newer link supersedes the pending loads, but the links of a bundle are all meant to open
+	const UHyperlinkSubsystem* const Subsystem
+		{ GEngine ? GEngine->GetEngineSubsystem<UHyperlinkSubsystem>() : nullptr };
+	if (!Subsystem || !Subsystem->IsExecutingBundle())
+	{
+		CancelPendingLoad();
+	}
+	const uint32 Serial{ ++LastSerial };
+
+	const UPackage* const LoadedPackage{ FindPackage(nullptr, *PackageName) };
+	if (LoadedPackage && LoadedPackage->IsFullyLoaded())
+	{
+		OnLoaded(LoadObject(PackageName));
+	}
+	else
+	{
+		// Request the dependencies which aren't loaded yet alongside the asset so they load in parallel
+		TArray<FName> Dependencies{};
+		IAssetRegistry::Get()->GetDependencies(FName(PackageName), Dependencies,
+			UE::AssetRegistry::EDependencyCategory::Package, UE::AssetRegistry::EDependencyQuery::Hard);
+		Dependencies.RemoveAll([](const FName& Dependency)
+		{
+			const FString DependencyString{ Dependency.ToString() };
+			return FPackageName::IsScriptPackage(DependencyString) || FindPackage(nullptr, *DependencyString);
+		});
+
+		FPendingLoad& Load{ PendingLoads.AddDefaulted_GetRef() };
+		Load.Serial = Serial;
+		Load.PackageName = PackageName;
+		Load.OnLoaded = MoveTemp(OnLoaded);
+		Load.NumRequests = Dependencies.Num() + 1;
+		Load.StartTime = FPlatformTime::Seconds();
+
+		FNotificationInfo Info{ GetProgressText(Load) };
+		Info.bFireAndForget = false;
+		Info.bUseSuccessFailIcons = true;
+		Info.ExpireDuration = 2.0f;
+		Info.ButtonDetails.Emplace(LOCTEXT("AsyncLoadCancel", "Cancel"), FText(),
+			FSimpleDelegate::CreateStatic(&CancelLoad, Serial), SNotificationItem::CS_Pending);
+		if (const TSharedPtr<SNotificationItem> Notification{ FSlateNotificationManager::Get().AddNotification(Info) })
+		{
+			Notification->SetCompletionState(SNotificationItem::CS_Pending);
+			Load.Notification = Notification;
+		}
+
+		for (const FName& Dependency : Dependencies)
+		{
+			LoadPackageAsync(Dependency.ToString(), FLoadPackageAsyncDelegate::CreateStatic(&OnPackageLoaded, Serial),
+				DependencyPriority);
+		}
+		LoadPackageAsync(PackageName, FLoadPackageAsyncDelegate::CreateStatic(&OnPackageLoaded, Serial), AssetPriority);
+	}
+}
+
+void FHyperlinkUtility::CancelPendingLoad()
+{
+	using namespace FHyperlinkAsyncLoad;
+	
+	while (PendingLoads.Num() > 0)
+	{
+		CancelLoad(PendingLoads.Last().Serial);
+	}
+}
+
+bool FHyperlinkUtility::IsLoadPending()
+{
+	using namespace FHyperlinkAsyncLoad;
+	return PendingLoads.Num() > 0;
+}
+
 UObject* FHyperlinkUtility::OpenEditorForAsset(const FString& PackageName)
 {
 	UObject* const Object{ LoadObject(PackageName) };
+	OpenEditorForLoadedAsset(PackageName, Object);
+	return Object;
+}
+
+void FHyperlinkUtility::OpenEditorForAssetAsync(const FName& PackageName, TFunction<void(UObject*)> OnOpened/*= nullptr*/)
+{
+	LoadObjectAsync(PackageName.ToString(), [PackageName, OnOpened = MoveTemp(OnOpened)](UObject* const Object)
+	{
+		OpenEditorForLoadedAsset(PackageName.ToString(), Object);
+		if (OnOpened)
+		{
+			OnOpened(Object);
+		}
+	});
+}
+
+void FHyperlinkUtility::OpenEditorForLoadedAsset(const FString& PackageName, UObject* const Object)
+{
+	HYPERLINK_SCOPE_CYCLE_COUNTER(STAT_HyperlinkOpenEditor);
+	
 	if (Object)
 	{
 		// Need to check if this is a level first. Levels will be reopened rather than focused by OpenEditorForAsset
@@ -276,7 +990,6 @@ UObject* FHyperlinkUtility::OpenEditorForAsset(const FString& PackageName)
 			GEditor->GetEditorSubsystem<UAssetEditorSubsystem>()->OpenEditorForAsset(Object);
 		}
 	}
-	return Object;
 }
 
 UObject* FHyperlinkUtility::OpenEditorForAsset(const FName& PackageName)
@@ -286,16 +999,42 @@ UObject* FHyperlinkUtility::OpenEditorForAsset(const FName& PackageName)
 
 FString FHyperlinkUtility::CreateClassDisplayString(const UClass* const Class)
 {
-	FString Identifier{ Class->GetDisplayNameText().ToString() };
+	return CreateDisplayStringFromDisplayName(Class->GetDisplayNameText().ToString());
+}
+
+FString FHyperlinkUtility::CreateBlueprintClassDisplayString(const FAssetData& BlueprintAsset)
+{
+	FString Identifier{};
+	
+	const FAssetTagValueRef GeneratedClassPath{
+		BlueprintAsset.TagsAndValues.FindTag(FBlueprintTags::GeneratedClassPath) };
+	if (GeneratedClassPath.IsSet())
+	{
+		// Mirror UField::GetDisplayNameText. The Blueprint display name becomes the class' DisplayName metadata when
+		// compiled, otherwise the display name is built from the generated class name, e.g. "BP_MyLink_C"
+		FString DisplayName{ BlueprintAsset.GetTagValueRef<FString>(
+			GET_MEMBER_NAME_CHECKED(UBlueprint, BlueprintDisplayName)) };
+		if (DisplayName.IsEmpty())
+		{
+			const FSoftObjectPath ClassPath{ FPackageName::ExportTextPathToObjectPath(GeneratedClassPath.GetValue()) };
+			DisplayName = FName::NameToDisplayString(ClassPath.GetAssetName(), false);
+		}
+		Identifier = CreateDisplayStringFromDisplayName(MoveTemp(DisplayName));
+	}
+	
+	return Identifier;
+}
+
+FString FHyperlinkUtility::CreateDisplayStringFromDisplayName(FString Identifier)
+{
 	Identifier.RemoveSpacesInline();
 	
 	// Try create a nice display name. Expect class names to typically follow the format "...HyperlinkType"
-	const FRegexPattern Pattern{ TEXT("Hyperlink(.*)$") };
-	FRegexMatcher Matcher{ Pattern, Identifier };
-
-	if (Matcher.FindNext())
+	static const FString Prefix{ TEXT("Hyperlink") };
+	const int32 PrefixIndex{ Identifier.Find(Prefix, ESearchCase::CaseSensitive) };
+	if (PrefixIndex != INDEX_NONE)
 	{
-		Identifier = Matcher.GetCaptureGroup(1);
+		Identifier.RightChopInline(PrefixIndex + Prefix.Len());
 	}
 	
 	return  Identifier;
@@ -0,0 +1,140 @@
+﻿// Copyright (c) 2023-2024 Fergus Brown. Licensed under the MIT license. See "LICENSE" file for details.
+
+
+#include "HyperlinkExecutePayload.h"
+#include "HyperlinkFormat.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace FHyperlinkFormatTestHelpers
+{
+	/* Clipboard contents of this many characters are parsed, then contents four times longer */
+	static constexpr int32 BaseLength{ 1024 * 1024 };
+	static constexpr int32 LengthScale{ 4 };
+	/* Linear parsing takes about LengthScale times as long. Quadratic parsing would take LengthScale^2 times */
+	static constexpr double MaxTimeScale{ LengthScale * 2.0 };
+	/* Times below this are too noisy to compare so are rounded up to it */
+	static constexpr double MinComparedSeconds{ 0.001 };
+	/* Parsing the longest contents must not stall the editor */
+	static constexpr double MaxSeconds{ 0.25 };
+	
+	/* Best of several runs, to ignore one off stalls */
+	static double TimeFindPayloadString(const FString& InString, bool& bOutFound)
+	{
+		double BestSeconds{ TNumericLimits<double>::Max() };
+		for (int32 Run{ 0 }; Run < 3; ++Run)
+		{
+			FStringView PayloadString{};
+			const double StartTime{ FPlatformTime::Seconds() };
+			bOutFound = FHyperlinkFormat::TryFindPayloadString(InString, PayloadString);
+			BestSeconds = FMath::Min(BestSeconds, FPlatformTime::Seconds() - StartTime);
+		}
+		return BestSeconds;
+	}
+	
+	struct FAdversarialCase
+	{
+		const TCHAR* Name;
+		/* Builds contents of at least the given length */
+		FString (*Build)(int32 Length);
+		bool bExpectFound;
+	};
+	
+	static const FAdversarialCase AdversarialCases[]
+	{
+		// Backtracked badly with the old "\{.*\}$" regex
+		{ TEXT("Open braces closed at the end"), [](const int32 Length)
+			{ return FString::ChrN(Length, TEXT('{')) + TEXT("}"); }, true },
+		{ TEXT("Open braces never closed"), [](const int32 Length)
+			{ return FString::ChrN(Length, TEXT('{')); }, false },
+		{ TEXT("Log lines ending in a brace"), [](const int32 Length)
+			{
+				FString Ret{};
+				Ret.Reserve(Length + 81);
+				while (Ret.Len() < Length)
+				{
+					Ret += FString::ChrN(79, TEXT('x')) + TEXT("}\n");
+				}
+				return Ret + FString::ChrN(Length, TEXT('y')) + TEXT("}");
+			}, false },
+		{ TEXT("Base64url characters without a prefix"), [](const int32 Length)
+			{ return FString::ChrN(Length, TEXT('A')); }, false },
+		{ TEXT("Line terminators"), [](const int32 Length)
+			{ return FString::ChrN(Length, TEXT('\n')); }, false },
+		{ TEXT("Huge binary payload"), [](const int32 Length)
+			{ return FString::ChrN(1, FHyperlinkFormat::BinaryPrefix) + FString::ChrN(Length, TEXT('A')); }, true },
+	};
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHyperlinkFormatFindPayloadTest, "Hyperlink.Format.FindPayloadString",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FHyperlinkFormatFindPayloadTest::RunTest(const FString& Parameters)
+{
+	const auto TestFind = [this](const TCHAR* const What, const FStringView InString, const TCHAR* const Expected)
+	{
+		FStringView PayloadString{};
+		const bool bFound{ FHyperlinkFormat::TryFindPayloadString(InString, PayloadString) };
+		TestEqual(FString::Printf(TEXT("%s found"), What), bFound, Expected != nullptr);
+		if (bFound && Expected)
+		{
+			TestEqual(What, FString(PayloadString), FString(Expected));
+		}
+	};
+	
+	const TCHAR* const JsonPayload{ TEXT("{\"Identifier\":\"Edit\",\"Payload\":{\"Name\":\"/Game/A\"}}") };
+	TestFind(TEXT("Link"), FString(TEXT("http://localhost:10416/Project/")) + JsonPayload, JsonPayload);
+	TestFind(TEXT("Link with trailing line terminators"),
+		FString(TEXT("http://localhost:10416/Project/")) + JsonPayload + TEXT("\r\n\n"), JsonPayload);
+	TestFind(TEXT("Link on the last line of a log"),
+		FString(TEXT("Error: {unrelated}\r\nhttp://localhost:10416/Project/")) + JsonPayload, JsonPayload);
+	TestFind(TEXT("Binary link"), TEXT("http://localhost:10416/Project/~AQIDBA-_"), TEXT("~AQIDBA-_"));
+	TestFind(TEXT("Binary prefix alone"), TEXT("http://localhost:10416/Project/~"), nullptr);
+	TestFind(TEXT("Closing brace alone"), TEXT("}"), nullptr);
+	TestFind(TEXT("Empty string"), TEXT(""), nullptr);
+	
+	return !HasAnyErrors();
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHyperlinkFormatAdversarialTest, "Hyperlink.Format.Adversarial",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FHyperlinkFormatAdversarialTest::RunTest(const FString& Parameters)
+{
+	using namespace FHyperlinkFormatTestHelpers;
+	
+	for (const FAdversarialCase& Case : AdversarialCases)
+	{
+		bool bFound{ false };
+		const FString ShortString{ Case.Build(BaseLength) };
+		const double ShortSeconds{ TimeFindPayloadString(ShortString, bFound) };
+		TestEqual(FString::Printf(TEXT("%s: payload found in %d characters"), Case.Name, ShortString.Len()), bFound,
+			Case.bExpectFound);
+		
+		const FString LongString{ Case.Build(BaseLength * LengthScale) };
+		const double LongSeconds{ TimeFindPayloadString(LongString, bFound) };
+		TestEqual(FString::Printf(TEXT("%s: payload found in %d characters"), Case.Name, LongString.Len()), bFound,
+			Case.bExpectFound);
+		
+		const double TimeScale
+			{ FMath::Max(LongSeconds, MinComparedSeconds) / FMath::Max(ShortSeconds, MinComparedSeconds) };
+		TestTrue(FString::Printf(TEXT("%s: %d times longer contents took %.1f times as long (%.3fms, %.3fms)"),
+			Case.Name, LengthScale, TimeScale, ShortSeconds * 1000.0, LongSeconds * 1000.0), TimeScale <= MaxTimeScale);
+		TestTrue(FString::Printf(TEXT("%s: %d characters took %.3fms"), Case.Name, LongString.Len(),
+			LongSeconds * 1000.0), LongSeconds <= MaxSeconds);
+		
+		// Deserializing whatever was found must fail cleanly rather than stall or crash
+		FStringView PayloadString{};
+		if (FHyperlinkFormat::TryFindPayloadString(LongString, PayloadString))
+		{
+			FHyperlinkExecutePayload Payload{};
+			TestFalse(FString::Printf(TEXT("%s: garbage payload deserialized"), Case.Name),
+				FHyperlinkFormat::TryDeserializeExecutePayload(PayloadString, Payload));
+		}
+	}
+	
+	return !HasAnyErrors();
+}
+
+#endif //WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,92 @@
+﻿// Copyright (c) 2023-2024 Fergus Brown. Licensed under the MIT license. See "LICENSE" file for details.
+
+
+#include "Engine/Engine.h"
+#include "HyperlinkClassEntry.h"
+#include "HyperlinkSettings.h"
+#include "HyperlinkSubsystem.h"
+#include "HyperlinkTestDefinition.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace FHyperlinkRefreshDefinitionsTestConstants
+{
+	static constexpr int32 NumDefinitions{ 128 };
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHyperlinkRefreshDefinitionsTest, "Hyperlink.RefreshDefinitions",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FHyperlinkRefreshDefinitionsTest::RunTest(const FString& Parameters)
+{
+	using namespace FHyperlinkRefreshDefinitionsTestConstants;
+	
+	UHyperlinkSubsystem* const Subsystem{ GEngine->GetEngineSubsystem<UHyperlinkSubsystem>() };
+	UHyperlinkSettings* const Settings{ GetMutableDefault<UHyperlinkSettings>() };
+	const FArrayProperty* const RegisteredDefinitionsProperty{ FindFProperty<FArrayProperty>(
+		UHyperlinkSettings::StaticClass(), TEXT("RegisteredDefinitions")) };
+	if (!TestNotNull(TEXT("Hyperlink subsystem"), Subsystem)
+		|| !TestNotNull(TEXT("RegisteredDefinitions property"), RegisteredDefinitionsProperty))
+	{
+		return false;
+	}
+	
+	// Edited the same way as the settings panel edits it, then restored
+	TArray<FHyperlinkClassEntry>& RegisteredDefinitions{ *RegisteredDefinitionsProperty->ContainerPtrToValuePtr<
+		TArray<FHyperlinkClassEntry>>(Settings) };
+	const TArray<FHyperlinkClassEntry> OriginalDefinitions{ RegisteredDefinitions };
+	
+	const int32 FirstIndex{ RegisteredDefinitions.Num() };
+	for (int32 Idx{ 0 }; Idx < NumDefinitions; ++Idx)
+	{
+		FHyperlinkClassEntry& Entry{ RegisteredDefinitions.AddDefaulted_GetRef() };
+		Entry.Class = UHyperlinkTestDefinition::StaticClass();
+		Entry.Identifier = FString::Printf(TEXT("HyperlinkRefreshTest%d"), Idx);
+	}
+	
+	UHyperlinkTestDefinition::ResetCounts();
+	Subsystem->RefreshDefinitions();
+	TestEqual(TEXT("Definitions initialized when added"), UHyperlinkTestDefinition::NumInitialized, NumDefinitions);
+	
+	// Check each kind of edit only touches the edited entry. The time taken is logged rather than tested, as it
+	// depends on the machine running the test
+	const auto TestEdit = [this, Subsystem](const TCHAR* const What, const int32 ExpectedInitialized,
+		const int32 ExpectedDeinitialized)
+	{
+		UHyperlinkTestDefinition::ResetCounts();
+		const double StartTime{ FPlatformTime::Seconds() };
+		Subsystem->RefreshDefinitions();
+		const double Seconds{ FPlatformTime::Seconds() - StartTime };
+		
+		AddInfo(FString::Printf(TEXT("%s with %d definitions took %.3fms"), What, NumDefinitions, Seconds * 1000.0));
+		TestEqual(FString::Printf(TEXT("%s: definitions initialized"), What),
+			UHyperlinkTestDefinition::NumInitialized, ExpectedInitialized);
+		TestEqual(FString::Printf(TEXT("%s: definitions deinitialized"), What),
+			UHyperlinkTestDefinition::NumDeinitialized, ExpectedDeinitialized);
+	};
+	
+	FHyperlinkClassEntry& EditedEntry{ RegisteredDefinitions[FirstIndex + NumDefinitions / 2] };
+	TestEdit(TEXT("Refresh without changes"), 0, 0);
+	
+	EditedEntry.Identifier += TEXT("Renamed");
+	TestEdit(TEXT("Rename one definition"), 0, 0);
+	TestNotNull(TEXT("Renamed definition found by its new identifier"),
+		Subsystem->GetDefinition(EditedEntry.Identifier));
+	
+	EditedEntry.bEnabled = false;
+	TestEdit(TEXT("Disable one definition"), 0, 1);
+	
+	EditedEntry.bEnabled = true;
+	TestEdit(TEXT("Enable one definition"), 1, 0);
+	
+	RegisteredDefinitions = OriginalDefinitions;
+	UHyperlinkTestDefinition::ResetCounts();
+	Subsystem->RefreshDefinitions();
+	TestEqual(TEXT("Definitions deinitialized when removed"), UHyperlinkTestDefinition::NumDeinitialized,
+		NumDefinitions);
+	
+	return !HasAnyErrors();
+}
+
+#endif //WITH_DEV_AUTOMATION_TESTS
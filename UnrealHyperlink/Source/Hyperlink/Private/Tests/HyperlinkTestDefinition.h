@@ -0,0 +1,33 @@
+﻿// Copyright (c) 2023-2024 Fergus Brown. Licensed under the MIT license. See "LICENSE" file for details.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HyperlinkDefinition.h"
+#include "HyperlinkTestDefinition.generated.h"
+
+/**
+ * Definition used by automation tests which counts how often it is initialized. Hidden from class pickers and
+ * skipped by UHyperlinkSettings::RegisterInMemoryClasses so it is never added to a project's registered definitions
+ */
+UCLASS(HideDropdown, NotBlueprintable)
+class UHyperlinkTestDefinition : public UHyperlinkDefinition
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize() override { ++NumInitialized; }
+	virtual void Deinitialize() override { ++NumDeinitialized; }
+#if WITH_EDITOR
+	virtual void ExecutePayload(const TSharedRef<FJsonObject>& InPayload) override {}
+#endif //WITH_EDITOR
+
+	static void ResetCounts()
+	{
+		NumInitialized = 0;
+		NumDeinitialized = 0;
+	}
+
+	static inline int32 NumInitialized{ 0 };
+	static inline int32 NumDeinitialized{ 0 };
+};
@@ -0,0 +1,118 @@
+﻿// Copyright (c) 2023-2024 Fergus Brown. Licensed under the MIT license. See "LICENSE" file for details.
+
+
+#include "HyperlinkUtility.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace FHyperlinkUrlCodecTestConstants
+{
+	struct FCase
+	{
+		const TCHAR* Input;
+		const TCHAR* Expected;
+	};
+	
+	/* Expected values are the output of python's urllib.parse.quote, which the python bridge used */
+	static const FCase EscapeCases[]
+	{
+		{ TEXT(""), TEXT("") },
+		{ TEXT("HyperlinkEdit"), TEXT("HyperlinkEdit") },
+		{ TEXT("/Game/Maps/Example Map"), TEXT("/Game/Maps/Example%20Map") },
+		{ TEXT("{\"Name\":\"/Game/Maps/Example Map\",\"Location\":{\"X\":1024.5,\"Y\":-2048.25,\"Z\":512}}"),
+			TEXT("%7B%22Name%22%3A%22/Game/Maps/Example%20Map%22%2C%22Location%22%3A%7B%22X%22%3A1024.5%2C%22Y%22%3A")
+			TEXT("-2048.25%2C%22Z%22%3A512%7D%7D") },
+		{ TEXT(" !\"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\\]^_`abcdefghijklmnopqrstuvwxyz{|}~"),
+			TEXT("%20%21%22%23%24%25%26%27%28%29%2A%2B%2C-./0123456789%3A%3B%3C%3D%3E%3F%40ABCDEFGHIJKLMNOPQRSTUVWXYZ")
+			TEXT("%5B%5C%5D%5E_%60abcdefghijklmnopqrstuvwxyz%7B%7C%7D~") },
+		{ TEXT("café"), TEXT("caf%C3%A9") },
+		{ TEXT("日本語"), TEXT("%E6%97%A5%E6%9C%AC%E8%AA%9E") },
+		{ TEXT("\U0001F600 smile"), TEXT("%F0%9F%98%80%20smile") },
+		{ TEXT("a+b=c&d?e#f"), TEXT("a%2Bb%3Dc%26d%3Fe%23f") },
+		{ TEXT("100%"), TEXT("100%25") },
+		{ TEXT("\t\r\n"), TEXT("%09%0D%0A") },
+	};
+	
+	/* Expected values are the output of python's urllib.parse.unquote, including its handling of invalid input */
+	static const FCase ParseCases[]
+	{
+		{ TEXT(""), TEXT("") },
+		{ TEXT("%20"), TEXT(" ") },
+		{ TEXT("%E6%97%A5%E6%9C%AC"), TEXT("日本") },
+		{ TEXT("%c3%a9"), TEXT("é") },
+		{ TEXT("a%2Bb+c"), TEXT("a+b+c") },
+		{ TEXT("%F0%9F%98%80"), TEXT("\U0001F600") },
+		// Incomplete or invalid escapes are kept as they are
+		{ TEXT("100%"), TEXT("100%") },
+		{ TEXT("%"), TEXT("%") },
+		{ TEXT("%4"), TEXT("%4") },
+		{ TEXT("%zz"), TEXT("%zz") },
+		{ TEXT("%4G1"), TEXT("%4G1") },
+		{ TEXT("%%41"), TEXT("%A") },
+		{ TEXT("%E2%82%AC%"), TEXT("€%") },
+		// Invalid UTF-8 is replaced one maximal invalid subsequence at a time
+		{ TEXT("%FF"), TEXT("\uFFFD") },
+		{ TEXT("%C3"), TEXT("\uFFFD") },
+		{ TEXT("%C3%28"), TEXT("\uFFFD(") },
+		{ TEXT("%E6%97"), TEXT("\uFFFD") },
+		{ TEXT("%ED%A0%80"), TEXT("\uFFFD\uFFFD\uFFFD") },
+		{ TEXT("%F4%90%80%80"), TEXT("\uFFFD\uFFFD\uFFFD\uFFFD") },
+		{ TEXT("%C0%AF"), TEXT("\uFFFD\uFFFD") },
+	};
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHyperlinkUrlCodecEscapeTest, "Hyperlink.UrlCodec.Escape",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FHyperlinkUrlCodecEscapeTest::RunTest(const FString& Parameters)
+{
+	using namespace FHyperlinkUrlCodecTestConstants;
+	
+	for (const FCase& Case : EscapeCases)
+	{
+		TestEqual(FString::Printf(TEXT("EscapeUrlString(\"%s\")"), Case.Input),
+			FHyperlinkUtility::EscapeUrlString(Case.Input), FString(Case.Expected));
+	}
+	
+	// The vectorised path handles 8 characters at a time, so move a character which must be escaped through every
+	// position of strings either side of that width
+	for (int32 Len{ 1 }; Len <= 24; ++Len)
+	{
+		for (int32 Pos{ 0 }; Pos < Len; ++Pos)
+		{
+			FString Input{ FString::ChrN(Len, TEXT('a')) };
+			Input[Pos] = TEXT(' ');
+			const FString Expected{ Input.Left(Pos) + TEXT("%20") + Input.RightChop(Pos + 1) };
+			TestEqual(FString::Printf(TEXT("EscapeUrlString of %d characters with a space at %d"), Len, Pos),
+				FHyperlinkUtility::EscapeUrlString(Input), Expected);
+		}
+	}
+	
+	return !HasAnyErrors();
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHyperlinkUrlCodecParseTest, "Hyperlink.UrlCodec.Parse",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FHyperlinkUrlCodecParseTest::RunTest(const FString& Parameters)
+{
+	using namespace FHyperlinkUrlCodecTestConstants;
+	
+	for (const FCase& Case : ParseCases)
+	{
+		TestEqual(FString::Printf(TEXT("ParseUrlString(\"%s\")"), Case.Input),
+			FHyperlinkUtility::ParseUrlString(Case.Input), FString(Case.Expected));
+	}
+	
+	// Parsing undoes escaping
+	for (const FCase& Case : EscapeCases)
+	{
+		TestEqual(FString::Printf(TEXT("ParseUrlString(\"%s\")"), Case.Expected),
+			FHyperlinkUtility::ParseUrlString(Case.Expected), FString(Case.Input));
+	}
+	
+	return !HasAnyErrors();
+}
+
+#endif //WITH_DEV_AUTOMATION_TESTS
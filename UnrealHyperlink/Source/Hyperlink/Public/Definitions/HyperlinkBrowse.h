@@ -3,7 +3,9 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "HyperlinkCommonPayload.h"
 #include "HyperlinkDefinition.h"
+#include "HyperlinkTypedDefinition.h"
 #include "HyperlinkBrowse.generated.h"
 
 #if WITH_EDITOR
@@ -16,6 +18,7 @@ public:
 public:
 	TSharedPtr<FUICommandInfo> CopyBrowseLink{ nullptr };
 	TSharedPtr<FUICommandInfo> CopyFolderLink{ nullptr };
+	TSharedPtr<FUICommandInfo> CopyBrowseLinks{ nullptr };
 };
 #endif //WITH_EDITOR
 
@@ -24,21 +27,24 @@ public:
  * Hyperlink for browsing to an asset/folder in the content browser
  */
 UCLASS()
-class HYPERLINK_API UHyperlinkBrowse : public UHyperlinkDefinition
+class HYPERLINK_API UHyperlinkBrowse : public UHyperlinkDefinition,
+	public THyperlinkTypedDefinition<FHyperlinkNamePayload>
 {
 	GENERATED_BODY()
+	HYPERLINK_TYPED_DEFINITION_BODY()
 
 public:
 #if WITH_EDITOR
 	virtual void Initialize() override;
 	virtual void Deinitialize() override;
+	virtual bool GetDeferredInitializeMenus(TArray<FName>& OutMenuNames) const override;
 #endif //WITH_EDITOR
 	
-	virtual TSharedPtr<FJsonObject> GeneratePayload(const TArray<FString>& Args) const override;
-	TSharedPtr<FJsonObject> GeneratePayloadFromPath(const FName& PackageOrFolderName) const;
+	virtual bool GenerateTypedPayload(const TArray<FString>& Args, FHyperlinkNamePayload& OutPayload) const override;
+	virtual bool GenerateTypedPayloads(const TArray<FString>& Args, TArray<FHyperlinkNamePayload>& OutPayloads) const override;
 
 #if WITH_EDITOR
-	virtual void ExecutePayload(const TSharedRef<FJsonObject>& InPayload) override;
+	virtual void ExecuteTypedPayload(const FHyperlinkNamePayload& InPayload) override;
 	
 private:
 	FDelegateHandle KeyboardShortcutHandle{};
@@ -0,0 +1,91 @@
+// Copyright (c) 2023-2024 Fergus Brown. Licensed under the MIT license. See "LICENSE" file for details.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HyperlinkDefinition.h"
+#include "HyperlinkTypedDefinition.h"
+#include "HyperlinkBundle.generated.h"
+
+#if WITH_EDITOR
+class FHyperlinkBundleCommands : public TCommands<FHyperlinkBundleCommands>
+{
+public:
+	FHyperlinkBundleCommands();
+	virtual void RegisterCommands() override;
+
+public:
+	TSharedPtr<FUICommandInfo> CopyWorkspaceLink{ nullptr };
+};
+#endif //WITH_EDITOR
+
+USTRUCT()
+struct FHyperlinkBundleEntry
+{
+	GENERATED_BODY()
+
+	/* Identifier of the definition registered in UHyperlinkSettings */
+	UPROPERTY()
+	FString Identifier{};
+
+	/* Payload string generated by the definition */
+	UPROPERTY()
+	FString Payload{};
+};
+
+USTRUCT()
+struct FHyperlinkBundlePayload
+{
+	GENERATED_BODY()
+
+	/* Links to execute, in order */
+	UPROPERTY()
+	TArray<FHyperlinkBundleEntry> Entries{};
+};
+
+/**
+ * Hyperlink for opening many targets at once e.g. to restore a workspace. The packages needed by the links in the
+ * bundle are loaded together with one async request before the links are executed in order
+ */
+UCLASS()
+class HYPERLINK_API UHyperlinkBundle : public UHyperlinkDefinition,
+	public THyperlinkTypedDefinition<FHyperlinkBundlePayload>
+{
+	GENERATED_BODY()
+	HYPERLINK_TYPED_DEFINITION_BODY()
+
+public:
+#if WITH_EDITOR
+	virtual void Initialize() override;
+	virtual void Deinitialize() override;
+	virtual bool GetDeferredInitializeMenus(TArray<FName>& OutMenuNames) const override;
+#endif //WITH_EDITOR
+
+	/**
+	 * Bundle the links generated by each definition identifier in Args e.g. "Edit LevelActor". With no arguments the
+	 * current workspace is bundled: the links of WorkspaceIdentifiers then an Edit link for each open asset editor
+	 */
+	virtual bool GenerateTypedPayload(const TArray<FString>& Args, FHyperlinkBundlePayload& OutPayload) const override;
+
+#if WITH_EDITOR
+	virtual void ExecuteTypedPayload(const FHyperlinkBundlePayload& InPayload) override;
+#endif //WITH_EDITOR
+
+private:
+	/* Add the links generated by a definition using the current editor/game state */
+	bool AddDefinitionEntries(const FString& Identifier, FHyperlinkBundlePayload& OutPayload) const;
+
+#if WITH_EDITOR
+	/* Add an Edit link for each asset open in an asset editor */
+	static bool AddAssetEditorEntries(FHyperlinkBundlePayload& OutPayload);
+#endif //WITH_EDITOR
+
+private:
+	/* Definitions included in workspace links. Levels should come first as links are executed in order */
+	UPROPERTY(Config)
+	TArray<FString> WorkspaceIdentifiers{ TEXT("LevelActor"), TEXT("Viewport") };
+
+#if WITH_EDITOR
+	TSharedPtr<FUICommandList> BundleCommands{};
+#endif //WITH_EDITOR
+};
@@ -3,7 +3,9 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "HyperlinkCommonPayload.h"
 #include "HyperlinkDefinition.h"
+#include "HyperlinkTypedDefinition.h"
 #include "HyperlinkEdit.generated.h"
 
 #if WITH_EDITOR
@@ -16,6 +18,7 @@ public:
 public:
 	TSharedPtr<FUICommandInfo> CopyContentBrowserLink{ nullptr };
 	TSharedPtr<FUICommandInfo> CopyAssetEditorLink{ nullptr };
+	TSharedPtr<FUICommandInfo> CopyContentBrowserLinks{ nullptr };
 };
 #endif //WITH_EDITOR
 
@@ -24,23 +27,32 @@ public:
  * Hyperlink for opening the editor for an asset
  */
 UCLASS()
-class HYPERLINK_API UHyperlinkEdit : public UHyperlinkDefinition
+class HYPERLINK_API UHyperlinkEdit : public UHyperlinkDefinition,
+	public THyperlinkTypedDefinition<FHyperlinkNamePayload>
 {
 	GENERATED_BODY()
+	HYPERLINK_TYPED_DEFINITION_BODY()
 
 public:
 #if WITH_EDITOR
 	virtual void Initialize() override;
 	virtual void Deinitialize() override;
+	virtual void PreInitialize() override;
+	virtual void PostDeinitialize() override;
+	virtual bool GetDeferredInitializeMenus(TArray<FName>& OutMenuNames) const override;
 #endif //WITH_EDITOR
 	
-	virtual TSharedPtr<FJsonObject> GeneratePayload(const TArray<FString>& Args) const override;
+	virtual bool GenerateTypedPayload(const TArray<FString>& Args, FHyperlinkNamePayload& OutPayload) const override;
+	virtual bool GenerateTypedPayloads(const TArray<FString>& Args, TArray<FHyperlinkNamePayload>& OutPayloads) const override;
+	/* JSON object payload for opening the editor for a package, as the typed payload would write */
 	static TSharedPtr<FJsonObject> GeneratePayloadFromPackageName(const FName& PackageName);
 #if WITH_EDITOR
+	static bool GeneratePayloadFromContentBrowser(FHyperlinkNamePayload& OutPayload);
 	static TSharedPtr<FJsonObject> GeneratePayloadFromContentBrowser();
 	TSharedPtr<FJsonObject> GeneratePayloadFromAssetEditor() const;
 	
-	virtual void ExecutePayload(const TSharedRef<FJsonObject>& InPayload) override;
+	virtual void ExecuteTypedPayload(const FHyperlinkNamePayload& InPayload) override;
+	virtual void GetTypedPayloadDependencies(const FHyperlinkNamePayload& InPayload, TArray<FName>& OutPackageNames) const override;
 private:
 	TSharedRef<FExtender> OnExtendAssetEditor(const TSharedRef<FUICommandList> CommandList,
 	                                          const TArray<UObject*> ContextSensitiveObjects);
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "HyperlinkDefinition.h"
+#include "HyperlinkTypedDefinition.h"
 #include "HyperlinkViewport.generated.h"
 
 #if WITH_EDITOR
@@ -37,22 +38,25 @@ struct FHyperlinkViewportPayload
  * Link type for teleporting viewport to a given location + rotation. Can be generated in-game
  */
 UCLASS()
-class HYPERLINK_API UHyperlinkViewport : public UHyperlinkDefinition
+class HYPERLINK_API UHyperlinkViewport : public UHyperlinkDefinition,
+	public THyperlinkTypedDefinition<FHyperlinkViewportPayload>
 {
 	GENERATED_BODY()
+	HYPERLINK_TYPED_DEFINITION_BODY()
 	
 public:
 	virtual void Initialize() override;
 	virtual void Deinitialize() override;
+#if WITH_EDITOR
+	virtual bool GetDeferredInitializeMenus(TArray<FName>& OutMenuNames) const override;
+#endif //WITH_EDITOR
 
 	/* Generate payload using the active level editor viewport (editor) or player controller (game). Fails if viewport not found */
-	virtual TSharedPtr<FJsonObject> GeneratePayload(const TArray<FString>& Args) const override;
-
-	/* Generate payload using the provided parameters */
-	TSharedPtr<FJsonObject> GeneratePayload(const FName& InLevelPackageName, const FVector& InLocation, const FRotator& InRotation) const;
+	virtual bool GenerateTypedPayload(const TArray<FString>& Args, FHyperlinkViewportPayload& OutPayload) const override;
 
 #if WITH_EDITOR
-	virtual void ExecutePayload(const TSharedRef<FJsonObject>& InPayload) override;
+	virtual void ExecuteTypedPayload(const FHyperlinkViewportPayload& InPayload) override;
+	virtual void GetTypedPayloadDependencies(const FHyperlinkViewportPayload& InPayload, TArray<FName>& OutPackageNames) const override;
 #endif //WITH_EDITOR
 
 private:
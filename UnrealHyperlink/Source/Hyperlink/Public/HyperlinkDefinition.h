@@ -21,21 +21,68 @@ public:
 	/* Tear down anything setup in Initialize */
 	virtual void Deinitialize() {}
 
+	/**
+	 * Setup cheap hooks which must be active from startup even when Initialize is deferred, e.g. delegates recording
+	 * editor state that generating a payload relies on. Called when the definition is created, before Initialize
+	 */
+	virtual void PreInitialize() {}
+
+	/* Tear down anything setup in PreInitialize. Called after Deinitialize, or instead of it if never initialized */
+	virtual void PostDeinitialize() {}
+
 	/* Generate payload using provided arguments or otherwise the current editor/game state */
 	virtual TSharedPtr<FJsonObject> GeneratePayload(const TArray<FString>& Args) const { return TSharedPtr<FJsonObject>(); }
 
+	/**
+	 * Generate payload as a JSON object string. By default this serializes the result of GeneratePayload, override
+	 * (or use THyperlinkTypedDefinition) to avoid creating a FJsonObject
+	 */
+	virtual bool GeneratePayloadString(const TArray<FString>& Args, FString& OutPayloadString) const;
+
+	/**
+	 * Generate a payload string for each selected item e.g. every selected asset. By default this generates a single
+	 * payload with GeneratePayloadString
+	 * @return false if no payloads could be generated
+	 */
+	virtual bool GeneratePayloadStrings(const TArray<FString>& Args, TArray<FString>& OutPayloadStrings) const;
+
 #if WITH_EDITOR
 	virtual void ExecutePayload(const TSharedRef<FJsonObject>& InPayload) PURE_VIRTUAL(UHyperlinkDefinition::ExecutePayload, );
+
+	/**
+	 * Execute a payload from a JSON object string. By default this deserializes the string and calls ExecutePayload,
+	 * override (or use THyperlinkTypedDefinition) to avoid creating a FJsonObject
+	 * @return false if the payload string couldn't be read
+	 */
+	virtual bool ExecutePayloadString(FStringView InPayloadString);
+
+	/**
+	 * Add the packages which must be loaded to execute a payload. Bundles load the packages of all their links with
+	 * one async request before executing any of them. By default a payload has no dependencies
+	 */
+	virtual void GetPayloadDependencies(FStringView InPayloadString, TArray<FName>& OutPackageNames) const {}
+
+	/**
+	 * Add the tool menus extended by Initialize. When deferred initialization is enabled in the settings, definitions
+	 * which return true are initialized when one of these menus is first opened or one of their links is first used
+	 * @return false to always initialize at startup (the default), e.g. if Initialize registers other hooks
+	 */
+	virtual bool GetDeferredInitializeMenus(TArray<FName>& OutMenuNames) const { return false; }
 #endif //WITH_EDITOR
 
 	/* Generate a link using the GeneratePayload function and copy it to clipboard */
 	void CopyLink() const;
 	void CopyLink(const TArray<FString>& Args) const;
 
+	/* Generate a link for each selected item using GeneratePayloadStrings and copy them to clipboard, one per line */
+	void CopyLinks() const;
+	void CopyLinks(const TArray<FString>& Args) const;
+
 	/* Generate a link using the GeneratePayload function and log it */
 	void PrintLink(const TArray<FString>& Args) const;
 	
 protected:
 	void CopyLink(const TSharedRef<FJsonObject>& Payload) const;
+	void CopyLinkFromPayloadString(FStringView PayloadString) const;
 	
 };
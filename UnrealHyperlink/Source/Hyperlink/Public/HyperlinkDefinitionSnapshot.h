@@ -0,0 +1,62 @@
+﻿// Copyright (c) 2023-2024 Fergus Brown. Licensed under the MIT license. See "LICENSE" file for details.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class UHyperlinkDefinition;
+
+/**
+ * Immutable view of the registered definitions. The subsystem builds a new snapshot whenever the definitions change
+ * and never modifies one it has published, so a snapshot can be read from any thread without locking e.g. to validate
+ * links before they reach the game thread. A reader can hold a snapshot after it has been replaced, so objects are
+ * only referenced weakly
+ */
+class HYPERLINK_API FHyperlinkDefinitionSnapshot
+	: public TSharedFromThis<FHyperlinkDefinitionSnapshot, ESPMode::ThreadSafe>
+{
+public:
+	struct FEntry
+	{
+		FString Identifier{};
+		FObjectKey Class{};
+		/* The registered definition. Only resolve on the game thread */
+		TWeakObjectPtr<UHyperlinkDefinition> Definition{ nullptr };
+		/*
+		 * Default object of the class, for stateless queries such as GetPayloadDependencies from other threads.
+		 * Resolve it inside an FGCScopeGuard there. Class, Definition and DefaultObject are null until the class is
+		 * loaded
+		 */
+		TWeakObjectPtr<const UHyperlinkDefinition> DefaultObject{ nullptr };
+	};
+
+	/* Add a definition while building the snapshot, before it is published */
+	void Add(const FString& Identifier, UHyperlinkDefinition* Definition);
+
+	/* Add a definition whose class hasn't been loaded yet. Its entry only has an identifier */
+	void AddUnloaded(const FString& Identifier);
+
+	/* @return the definition registered with the identifier, nullptr if not registered */
+	const FEntry* FindByIdentifier(const FString& Identifier) const;
+
+	/* As FindByIdentifier, for callers which already have the identifier's hash (GetTypeHash) */
+	const FEntry* FindByIdentifierHash(uint32 IdentifierHash, const FString& Identifier) const;
+
+	/* @return the definition of the class, or otherwise a subclass of it, nullptr if not registered */
+	const FEntry* FindByClass(const UClass* Class) const;
+
+	int32 Num() const { return Entries.Num(); }
+
+	TConstArrayView<FEntry> GetEntries() const { return Entries; }
+
+private:
+	TArray<FEntry> Entries{};
+	TMap<FString, int32> IdentifierIndices{};
+	/*
+	 * Entry for each registered class and each of its superclasses up to UHyperlinkDefinition. Looking up a base
+	 * class finds the first registered subclass, as IsA would, with a single probe. Exact classes take priority
+	 */
+	TMap<FObjectKey, int32> ClassIndices{};
+};
@@ -13,9 +13,14 @@ struct FHyperlinkExecutePayload
 {
 	GENERATED_BODY()
 
+	/* Full class of the definition. Only used when the definition has no registered identifier */
 	UPROPERTY(BlueprintReadWrite, Category = HyperlinkExecutePayload)
 	TSubclassOf<UHyperlinkDefinition> Class{ nullptr };
 
+	/* Identifier of the definition registered in UHyperlinkSettings. Takes priority over Class when set */
+	UPROPERTY(BlueprintReadWrite, Category = HyperlinkExecutePayload)
+	FString Identifier{};
+
 	UPROPERTY(BlueprintReadWrite, Category = HyperlinkExecutePayload)
 	FJsonObjectWrapper DefinitionPayload{};
 };
\ No newline at end of file
@@ -0,0 +1,73 @@
+﻿// Copyright (c) 2023-2024 Fergus Brown. Licensed under the MIT license. See "LICENSE" file for details.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HyperlinkFormat.generated.h"
+
+class FCbWriter;
+class FCbObjectView;
+class FJsonObject;
+struct FHyperlinkExecutePayload;
+
+/* The encoding used for the payload part of a link */
+UENUM()
+enum class EHyperlinkLinkFormat : uint8
+{
+	/* Human readable JSON. Compatible with all versions of the plugin */
+	Json,
+	/* Versioned compact binary encoded as base64url. Much shorter than JSON once escaped */
+	Binary,
+};
+
+/**
+ * Serialization of execute payloads to and from the payload string used in links
+ */
+class HYPERLINK_API FHyperlinkFormat
+{
+public:
+	/* First character of a binary payload string. '~' is never escaped and is not part of the base64url alphabet */
+	static constexpr TCHAR BinaryPrefix{ TEXT('~') };
+
+	/* Version byte written at the start of a binary payload. Increment when the layout changes */
+	static constexpr uint8 BinaryVersion{ 1 };
+
+	/**
+	 * @brief Serialize an execute payload to a string which can be placed in a link (before URL escaping)
+	 * @param InPayload The payload to serialize
+	 * @param Format The format to serialize in
+	 * @return The payload string, empty on failure
+	 */
+	static FString SerializeExecutePayload(const FHyperlinkExecutePayload& InPayload, EHyperlinkLinkFormat Format);
+
+	/**
+	 * @brief Deserialize a payload string created by SerializeExecutePayload. The format is detected from the first
+	 * character so links created before the binary format was added still work
+	 * @param InPayloadString The payload string with any URL escaping already removed
+	 * @param OutPayload Deserialized payload
+	 * @return true if operation was successful
+	 */
+	static bool TryDeserializeExecutePayload(FStringView InPayloadString, FHyperlinkExecutePayload& OutPayload);
+
+	/**
+	 * @brief Find the payload string at the end of the last line of a string, e.g. a link with its URL escaping
+	 * removed. Runs in linear time and does not allocate
+	 * @param InString String ending in a payload string
+	 * @param OutPayloadString View of the payload string within InString
+	 * @return true if a payload string was found
+	 */
+	static bool TryFindPayloadString(FStringView InString, FStringView& OutPayloadString);
+
+	/* Conversion between JSON objects and compact binary objects */
+	static void WriteJsonObject(FCbWriter& Writer, const FJsonObject& InObject);
+	static TSharedRef<FJsonObject> ReadJsonObject(const FCbObjectView& InObject);
+
+	/* Streaming conversion between JSON object strings and compact binary objects which doesn't create a FJsonObject */
+	static bool WriteJsonString(FCbWriter& Writer, FStringView InJsonString);
+	static void ReadJsonString(const FCbObjectView& InObject, FString& OutJsonString);
+
+private:
+	static FString SerializeJson(const FHyperlinkExecutePayload& InPayload);
+	static FString SerializeBinary(const FHyperlinkExecutePayload& InPayload);
+	static bool TryDeserializeBinary(FStringView InPayloadString, FHyperlinkExecutePayload& OutPayload);
+};
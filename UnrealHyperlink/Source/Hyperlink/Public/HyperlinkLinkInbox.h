@@ -0,0 +1,54 @@
+﻿// Copyright (c) 2023-2024 Fergus Brown. Licensed under the MIT license. See "LICENSE" file for details.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/MpscQueue.h"
+#include "HyperlinkExecutePayload.h"
+
+#include <atomic>
+
+/**
+ * Bounded queue of links waiting to be executed. Any thread can push (HTTP handlers, the console, clipboard paste,
+ * Blueprint calls) without taking a lock, and the game thread pops them in the order they were pushed.
+ * Links pushed while the inbox is full are dropped and counted so the consumer can report them.
+ */
+class HYPERLINK_API FHyperlinkLinkInbox
+{
+public:
+	/* @param InCapacity Maximum number of links waiting to be executed */
+	explicit FHyperlinkLinkInbox(int32 InCapacity);
+
+	FHyperlinkLinkInbox(const FHyperlinkLinkInbox&) = delete;
+	FHyperlinkLinkInbox& operator=(const FHyperlinkLinkInbox&) = delete;
+
+	/**
+	 * @brief Add a link to the inbox. Thread safe
+	 * @param Payload The link to execute
+	 * @return false if the inbox is full and the link was dropped
+	 */
+	bool Push(FHyperlinkExecutePayload Payload);
+
+	/**
+	 * @brief Take the oldest link from the inbox. Must only be called from one thread
+	 * @param OutPayload The link to execute
+	 * @return false if the inbox is empty
+	 */
+	bool Pop(FHyperlinkExecutePayload& OutPayload);
+
+	/* @return the number of links waiting, may be out of date as soon as it's returned if other threads are pushing */
+	int32 Num() const { return NumQueued.load(std::memory_order_relaxed); }
+	bool IsEmpty() const { return Num() == 0; }
+	int32 GetCapacity() const { return Capacity; }
+
+	/* @return the number of links dropped since the last call */
+	uint32 ConsumeNumDropped() { return NumDropped.exchange(0, std::memory_order_relaxed); }
+
+private:
+	TMpscQueue<FHyperlinkExecutePayload> Queue{};
+	const int32 Capacity;
+
+	/* Reserved before pushing to the queue, so it can't exceed Capacity even with many producers */
+	std::atomic<int32> NumQueued{ 0 };
+	std::atomic<uint32> NumDropped{ 0 };
+};
@@ -0,0 +1,120 @@
+﻿// Copyright (c) 2023-2024 Fergus Brown. Licensed under the MIT license. See "LICENSE" file for details.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Hash/xxhash.h"
+
+/**
+ * Content addressed store for link payload strings which are too long to put in a URL. Links to stored payloads
+ * contain only the hash of the payload e.g. "http://localhost:10416/Project/h/<hash>".
+ * Payloads are appended to a segment file owned by this user and machine, so the store directory can be shared by
+ * syncing it through source control without conflicts. Segments are read into memory, rather than mapped, so they
+ * aren't locked while source control replaces them, and indexed by hash on load.
+ */
+class HYPERLINK_API FHyperlinkLinkStore
+{
+public:
+	/* Path between the link base address and the hash of a stored payload */
+	static constexpr TCHAR LinkPathSegment{ TEXT('h') };
+
+	/* Number of characters in a hash string */
+	static constexpr int32 HashLength{ 32 };
+
+	/**
+	 * @param InDirectory Directory containing the segment files, created on first store
+	 * @param InTimeToLive Age after which stored payloads are removed by Compact, zero to keep payloads forever
+	 */
+	FHyperlinkLinkStore(const FString& InDirectory, const FTimespan& InTimeToLive);
+
+	FHyperlinkLinkStore(const FHyperlinkLinkStore&) = delete;
+	FHyperlinkLinkStore& operator=(const FHyperlinkLinkStore&) = delete;
+
+	/**
+	 * @brief Store a payload string. Storing a payload which is already in the store doesn't write anything
+	 * @param InPayloadString The payload string (before URL escaping)
+	 * @return The hash string used in links to the payload, empty on failure
+	 */
+	FString Store(FStringView InPayloadString);
+
+	/**
+	 * @brief Keep a stored payload from expiring while links to it are still being handed out, by writing it again
+	 * once it's half way to expiring in the same way as Store
+	 * @param InHash Hash string returned by Store
+	 * @return false if the payload is no longer in the store, so it must be stored again
+	 */
+	bool Touch(FStringView InHash);
+
+	/**
+	 * @brief Find a stored payload string. If the hash isn't found, segments which have changed on disk are reloaded
+	 * in case they've been synced, at most once a second
+	 * @param InHash Hash string returned by Store
+	 * @param OutPayloadString The stored payload string
+	 * @return true if the payload was found
+	 */
+	bool TryResolve(FStringView InHash, FString& OutPayloadString);
+
+	/**
+	 * @brief Find the hash at the end of a link to a stored payload e.g. "http://localhost:10416/Project/h/<hash>"
+	 * @param InString String ending in a link with its URL escaping removed
+	 * @param OutHash View of the hash string within InString
+	 * @return true if the string ends in a link to a stored payload
+	 */
+	static bool TryFindHash(FStringView InString, FStringView& OutHash);
+
+	/* Remove expired and superseded records from this user's segment. Also runs every few hundred appends */
+	void Compact();
+
+	/* Reload all segments in the store directory */
+	void Refresh();
+
+	const FString& GetDirectory() const { return Directory; }
+
+private:
+	struct FSegment
+	{
+		FString Filename{};
+		TArray<uint8> Data{};
+		/* Size and timestamp of the file when it was read, to tell whether it has changed. -1 if it couldn't be read */
+		int64 FileSize{ -1 };
+		FDateTime Timestamp{};
+	};
+
+	/* Location of a payload within the segments */
+	struct FRecordLocation
+	{
+		int32 SegmentIndex{ INDEX_NONE };
+		int64 PayloadOffset{ 0 };
+		uint32 PayloadSize{ 0 };
+		int64 Timestamp{ 0 };
+	};
+
+	/* Read segments which have been added or changed since they were last read, or every segment if bForce */
+	void RescanSegments(bool bForce);
+	void RebuildIndex();
+	void IndexSegment(int32 SegmentIndex);
+	void IndexRecord(const FXxHash128& Hash, const FRecordLocation& InLocation);
+	static void UpdateSegmentStat(FSegment& Segment);
+	int32 FindOwnSegment() const;
+	/* Append a record to this user's segment file and its copy in memory. Refuses if the file couldn't be read */
+	bool AppendRecord(const FXxHash128& Hash, const uint8* Payload, uint32 PayloadSize);
+	bool NeedsRewrite(const FRecordLocation& Location) const;
+	bool IsExpired(int64 Timestamp, int64 Now) const;
+
+	static FString HashToString(const FXxHash128& Hash);
+	static bool TryParseHash(FStringView InHash, FXxHash128& OutHash);
+
+private:
+	FString Directory{};
+	/* The segment this user appends to */
+	FString OwnSegmentFilename{};
+	FTimespan TimeToLive{};
+
+	TArray<FSegment> Segments{};
+	TMap<FXxHash128, FRecordLocation> Index{};
+	/* FPlatformTime::Seconds of the last rescan */
+	double LastRescanTime{ 0.0 };
+	int32 NumAppendsSinceCompact{ 0 };
+
+	FCriticalSection CriticalSection{};
+};
@@ -0,0 +1,32 @@
+﻿// Copyright (c) 2023-2024 Fergus Brown. Licensed under the MIT license. See "LICENSE" file for details.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+enum class EHyperlinkDecodeResult : uint8;
+
+/**
+ * Counts the links received, executed and rejected, and measures how long each definition takes to execute them.
+ * Read by the local /metrics endpoint so tooling can tell whether links are slow or failing. Counters are thread safe,
+ * execute times are recorded and exported on the game thread
+ */
+class HYPERLINK_API FHyperlinkMetrics
+{
+public:
+	/* Count a link which was decoded, rejected unless Result is Success */
+	static void RecordDecode(EHyperlinkDecodeResult Result);
+	/* Count links dropped because too many were waiting to execute */
+	static void RecordDropped(uint32 NumLinks);
+	/* Count a link skipped because the same link was already executed in the burst */
+	static void RecordCoalesced();
+	/**
+	 * @brief Count a link passed to its definition
+	 * @param Identifier The identifier of the definition which executed the link
+	 * @param Seconds How long the definition took to execute it, not including any asynchronous loading
+	 */
+	static void RecordExecuted(const FString& Identifier, double Seconds);
+
+	/* @return every metric in the Prometheus text exposition format */
+	static FString ExportPrometheus();
+};
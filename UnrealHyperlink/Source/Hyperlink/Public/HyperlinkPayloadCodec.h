@@ -0,0 +1,53 @@
+﻿// Copyright (c) 2023-2024 Fergus Brown. Licensed under the MIT license. See "LICENSE" file for details.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Streaming conversion between USTRUCTs and the JSON payload strings used in links. Produces and accepts the same JSON
+ * as FJsonObjectConverter but reads and writes the struct directly without building an intermediate FJsonObject.
+ * Structs containing property types the codec doesn't support (e.g. objects, sets or maps) fall back to
+ * FJsonObjectConverter
+ */
+class HYPERLINK_API FHyperlinkPayloadCodec
+{
+public:
+	/**
+	 * @brief Write a struct as a condensed JSON object string
+	 * @param Struct Type of the struct
+	 * @param InStruct The struct to write
+	 * @param OutPayloadString The JSON object string
+	 * @return true if operation was successful
+	 */
+	static bool WriteStruct(const UScriptStruct* Struct, const void* InStruct, FString& OutPayloadString);
+
+	/**
+	 * @brief Read a struct from a JSON object string
+	 * @param InPayloadString The JSON object string
+	 * @param Struct Type of the struct
+	 * @param OutStruct The struct to read into
+	 * @param bStrict Fail if any of the struct's properties are missing, as in FJsonObjectConverter
+	 * @return true if operation was successful
+	 */
+	static bool ReadStruct(FStringView InPayloadString, const UScriptStruct* Struct, void* OutStruct,
+		bool bStrict = false);
+};
+
+/**
+ * Type safe payload codec. Specialize for a payload type to replace the reflection based FHyperlinkPayloadCodec with a
+ * hand written one
+ */
+template<typename TPayload>
+struct THyperlinkPayloadCodec
+{
+	static bool Write(const TPayload& InPayload, FString& OutPayloadString)
+	{
+		return FHyperlinkPayloadCodec::WriteStruct(TPayload::StaticStruct(), &InPayload, OutPayloadString);
+	}
+
+	static bool Read(const FStringView InPayloadString, TPayload& OutPayload, const bool bStrict = false)
+	{
+		return FHyperlinkPayloadCodec::ReadStruct(InPayloadString, TPayload::StaticStruct(), &OutPayload, bStrict);
+	}
+};
@@ -19,11 +19,13 @@ public:
 	static const UHyperlinkPythonBridge* Get();
 	static const UHyperlinkPythonBridge& GetChecked();
 
-	/* Decode any escaped special characters in the URL. For example replacing "%7B" with '{' */
+	/* Decode any escaped special characters in the URL. For example replacing "%7B" with '{'
+	 * Note: FHyperlinkUtility::ParseUrlString gives the same output without a round trip to python */
 	UFUNCTION(BlueprintImplementableEvent)
 	FString ParseUrlString(const FString& InString) const;
 
-	/* Escape special characters in the URL. For or example replacing '{' with "%7B" */
+	/* Escape special characters in the URL. For or example replacing '{' with "%7B"
+	 * Note: FHyperlinkUtility::EscapeUrlString gives the same output without a round trip to python */
 	UFUNCTION(BlueprintImplementableEvent)
 	FString EscapeUrlString(const FString& InString) const;
 
@@ -4,8 +4,12 @@
 
 #include "CoreMinimal.h"
 #include "Engine/DeveloperSettings.h"
+#include "Engine/EngineTypes.h"
+#include "HyperlinkFormat.h"
 #include "HyperlinkSettings.generated.h"
 
+class UHyperlinkDefinition;
+
 UCLASS(Config = Hyperlink, DefaultConfig, meta = (DisplayName = "Hyperlink"))
 class HYPERLINK_API UHyperlinkSettings : public UDeveloperSettings
 {
@@ -23,6 +27,13 @@ public:
 
 	const FString& GetProjectIdentifier() const{ return ProjectIdentifier; };
 	uint32 GetLocalServerPort() const{ return LocalServerPort; };
+	EHyperlinkLinkFormat GetLinkFormat() const{ return LinkFormat; };
+	bool GetUseLinkStore() const{ return bUseLinkStore; };
+	int32 GetMaxLinkPayloadLength() const{ return MaxLinkPayloadLength; };
+	FString GetLinkStoreDirectory() const;
+	FTimespan GetLinkStoreTimeToLive() const;
+	bool GetDeferDefinitionInitialize() const{ return bDeferDefinitionInitialize; };
+	bool GetPreloadBlueprintDefinitions() const{ return bPreloadBlueprintDefinitions; };
 	
 #if WITH_EDITOR
 private:
@@ -44,7 +55,11 @@ private:
 	 */
 	bool RegisterBlueprintClasses();
 	
-	bool RegisterDefinitionClass(UClass* Class);
+	/**
+	 * @brief Add an entry for a definition class which isn't registered yet. The class doesn't need to be loaded
+	 * @return true if the class was registered
+	 */
+	bool RegisterDefinitionClass(const TSoftClassPtr<UHyperlinkDefinition>& Class, FString Identifier);
 	
 	void PostRegister();
 #endif //WITH_EDITOR
@@ -57,6 +72,47 @@ protected:
 	/** The port of the web server used for handling links. */
 	UPROPERTY(config, EditAnywhere, Category = "Project")
 	uint32 LocalServerPort{ 10416 }; // (Rudy's Birthday, hopefully unused)
+
+	/*
+	 * The format used for the payload of generated links. Binary links are much shorter but can only be opened by
+	 * versions of the plugin which support them. Links in either format can always be opened.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Project")
+	EHyperlinkLinkFormat LinkFormat{ EHyperlinkLinkFormat::Json };
+
+	/* Save payloads which are too long for a URL to the link store and link to them by hash instead */
+	UPROPERTY(Config, EditAnywhere, Category = "LinkStore")
+	bool bUseLinkStore{ true };
+
+	/* Escaped payloads longer than this are saved to the link store. Set to 0 to store every payload */
+	UPROPERTY(Config, EditAnywhere, Category = "LinkStore", meta = (EditCondition = "bUseLinkStore", ClampMin = 0))
+	int32 MaxLinkPayloadLength{ 2000 };
+
+	/*
+	 * Directory the link store is saved to, "Saved/Hyperlink" if empty. Use a directory in the project which is synced
+	 * through source control to share stored links with the team
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "LinkStore", meta = (EditCondition = "bUseLinkStore", RelativeToGameDir))
+	FDirectoryPath LinkStoreDirectory{};
+
+	/* Number of days stored payloads are kept for after they were last used to create a link. 0 keeps them forever */
+	UPROPERTY(Config, EditAnywhere, Category = "LinkStore", meta = (EditCondition = "bUseLinkStore", ClampMin = 0))
+	int32 LinkStoreTimeToLiveDays{ 90 };
+	
+	/*
+	 * Initialize definitions which support it when one of their menus is first opened or one of their links is first
+	 * used, rather than at startup. Content browser keyboard shortcuts only work in content browsers opened after the
+	 * definition has initialized.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Startup", meta = (ConfigRestartRequired = true))
+	bool bDeferDefinitionInitialize{ false };
+	
+	/*
+	 * Load Blueprint definitions in the background after startup so their menu entries are added. Otherwise each one
+	 * is loaded when one of its links is first used, and its menu entries only appear from then on.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Startup")
+	bool bPreloadBlueprintDefinitions{ false };
 	
 	/*
 	 * List of definitions discovered in this project and whether each definition is enabled
@@ -68,6 +124,8 @@ protected:
 private:
 	bool bInMemoryClassesRegistered{ false };
 	bool bBlueprintClassesRegistered{ false };
+	/* Whether RegisteredDefinitions differs from the saved config */
+	bool bRegisteredDefinitionsChanged{ false };
 	
 	friend class FHyperlinkSettingsCustomization;
 };
@@ -0,0 +1,59 @@
+﻿// Copyright (c) 2023-2024 Fergus Brown. Licensed under the MIT license. See "LICENSE" file for details.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Records the time and memory the plugin adds to editor startup and definition refreshes. Measurements with the same
+ * name are accumulated, e.g. every Initialize of one definition class. Game thread only
+ */
+class HYPERLINK_API FHyperlinkStartupProfiler
+{
+public:
+	/* Measure the lifetime of the scope */
+	class HYPERLINK_API FScope
+	{
+	public:
+		explicit FScope(FString InName);
+		~FScope();
+
+		FScope(const FScope&) = delete;
+		FScope& operator=(const FScope&) = delete;
+
+	private:
+		FString Name;
+		double StartTime;
+		int64 StartMemory;
+	};
+
+	struct FEntry
+	{
+		FString Name{};
+		int32 Count{ 0 };
+		double Seconds{ 0.0 };
+		/*
+		 * Change in memory allocated under the Hyperlink LLM tag, so allocations elsewhere in the editor don't add
+		 * noise. Only measured with -llm, can be negative if memory was freed
+		 */
+		int64 MemoryBytes{ 0 };
+	};
+
+	/* Add a measurement */
+	static void Record(const FString& Name, double Seconds, int64 MemoryBytes);
+
+	/* @return every measurement, slowest first */
+	static TArray<FEntry> GetEntries();
+
+	/* Log a table of every measurement, slowest first */
+	static void PrintReport();
+
+	/**
+	 * @brief Write every measurement as JSON so reports from different builds can be compared
+	 * @return true if the file was written
+	 */
+	static bool WriteReport();
+
+	/* @return the path WriteReport writes to, "Saved/Hyperlink/startup.json" */
+	static FString GetReportPath();
+};
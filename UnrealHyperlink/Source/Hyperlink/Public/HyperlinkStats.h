@@ -0,0 +1,47 @@
+﻿// Copyright (c) 2023-2024 Fergus Brown. Licensed under the MIT license. See "LICENSE" file for details.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/LowLevelMemTracker.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Stats/Stats.h"
+#include "Trace/Trace.h"
+
+/*
+ * Profiling of the link pipeline. Timed scopes appear in Unreal Insights on the Hyperlink trace channel (enable with
+ * -trace=cpu,hyperlink) and in "stat Hyperlink". Plugin allocations are tagged for "stat llm"
+ */
+
+UE_TRACE_CHANNEL_EXTERN(HyperlinkChannel, HYPERLINK_API);
+
+DECLARE_STATS_GROUP(TEXT("Hyperlink"), STATGROUP_Hyperlink, STATCAT_Advanced);
+
+/* Link execution, in pipeline order */
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Decode Link"), STAT_HyperlinkDecodeLink, STATGROUP_Hyperlink, HYPERLINK_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("URL Decode"), STAT_HyperlinkUrlDecode, STATGROUP_Hyperlink, HYPERLINK_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Extract Payload"), STAT_HyperlinkExtractPayload, STATGROUP_Hyperlink, HYPERLINK_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("JSON Conversion"), STAT_HyperlinkJsonConversion, STATGROUP_Hyperlink, HYPERLINK_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Dispatch To Definition"), STAT_HyperlinkDispatch, STATGROUP_Hyperlink, HYPERLINK_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Package Load"), STAT_HyperlinkPackageLoad, STATGROUP_Hyperlink, HYPERLINK_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Open Editor"), STAT_HyperlinkOpenEditor, STATGROUP_Hyperlink, HYPERLINK_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Move Viewport"), STAT_HyperlinkMoveViewport, STATGROUP_Hyperlink, HYPERLINK_API);
+
+/* Link generation */
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Create Link"), STAT_HyperlinkCreateLink, STATGROUP_Hyperlink, HYPERLINK_API);
+
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Links Queued"), STAT_HyperlinkLinksQueued, STATGROUP_Hyperlink,
+	HYPERLINK_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Links Dropped"), STAT_HyperlinkLinksDropped, STATGROUP_Hyperlink,
+	HYPERLINK_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Links Coalesced"), STAT_HyperlinkLinksCoalesced, STATGROUP_Hyperlink,
+	HYPERLINK_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Links Executed"), STAT_HyperlinkLinksExecuted, STATGROUP_Hyperlink,
+	HYPERLINK_API);
+
+LLM_DECLARE_TAG_API(Hyperlink, HYPERLINK_API);
+
+/* Time a scope in both Unreal Insights and the Hyperlink stat group */
+#define HYPERLINK_SCOPE_CYCLE_COUNTER(Stat) \
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(Stat, HyperlinkChannel); \
+	SCOPE_CYCLE_COUNTER(Stat)
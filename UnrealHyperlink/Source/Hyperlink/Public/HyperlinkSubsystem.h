@@ -3,11 +3,45 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "HyperlinkDefinitionSnapshot.h"
+#include "HyperlinkLinkInbox.h"
+#include "HyperlinkLinkStore.h"
 #include "Subsystems/EngineSubsystem.h"
+
+#include <atomic>
+
 #include "HyperlinkSubsystem.generated.h"
 
 class UHyperlinkDefinition;
+class UToolMenu;
 struct FHyperlinkExecutePayload;
+struct FStreamableHandle;
+
+/* Outcome of decoding and validating a link before it is executed */
+enum class EHyperlinkDecodeResult : uint8
+{
+	Success,
+	/* No payload could be read from the link */
+	Malformed,
+	/* The link is to a stored payload which isn't in the link store */
+	NotStored,
+	/* The link's definition isn't registered in this project */
+	UnknownDefinition,
+	/* An asset the link opens doesn't exist */
+	MissingAsset,
+};
+
+/* Outcome of queueing a link to be executed */
+enum class EHyperlinkQueueResult : uint8
+{
+	Queued,
+	/* Identical to a link queued moments ago, so it is merged with that link rather than executed again */
+	Coalesced,
+	/* Too many links were waiting to execute and this one was dropped */
+	Dropped,
+};
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnHyperlinkDispatched, const FHyperlinkExecutePayload&);
 
 /**
  * 
@@ -26,12 +60,94 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Hyperlink")
 	static void StaticExecuteLink(const FHyperlinkExecutePayload& ExecutePayload);
 	
-	void ExecuteLink(const FHyperlinkExecutePayload& ExecutePayload);
-	void ExecuteLink(const FString& InString);
+	/**
+	 * Queue a link to be executed after the editor tick. Thread safe. Links are executed in the order they are queued,
+	 * spread over several frames if there are many. A link identical to one queued within the last second is
+	 * coalesced with it and only executed once, e.g. when a browser sends a request twice
+	 * @return whether the link was queued, coalesced or dropped
+	 */
+	EHyperlinkQueueResult QueueLink(const FHyperlinkExecutePayload& ExecutePayload);
+	/* As QueueLink. @return false if too many links are waiting and this one was dropped */
+	bool ExecuteLink(const FHyperlinkExecutePayload& ExecutePayload);
+	/* @return false if the string isn't a valid link or the link was dropped */
+	bool ExecuteLink(FStringView InString);
+
+	/**
+	 * @brief Extract the payload from the end of a string and check it can be executed: its definition must be
+	 * registered and the assets it opens must exist. Linear in the length of the string and only the last line is
+	 * decoded. Thread safe, get the snapshot and link store on the game thread. Doesn't record metrics, so benchmarks
+	 * don't show up in them, the transport which received the link does
+	 * @param InString String which ends in a (possibly URL escaped) payload string or link store hash
+	 * @param Snapshot The registered definitions
+	 * @param LinkStore Used to resolve links to stored payloads, may be nullptr
+	 * @param OutPayload Deserialized payload
+	 * @return Success, or why the link can't be executed
+	 */
+	static EHyperlinkDecodeResult DecodeLink(FStringView InString, const FHyperlinkDefinitionSnapshot& Snapshot,
+		FHyperlinkLinkStore* LinkStore, FHyperlinkExecutePayload& OutPayload);
+
+	/**
+	 * @brief Execute links in order once every package they depend on has been loaded by a single async request. A
+	 * bundle executed while another is still loading replaces it
+	 * @param Payloads The links to execute
+	 */
+	void ExecuteBundle(TArray<FHyperlinkExecutePayload> Payloads);
+
+	/* @return true while the links of a bundle are being executed */
+	bool IsExecutingBundle() const { return bExecutingBundle; }
+
+	/**
+	 * @brief Call on the game thread when a link arrives from outside the editor, e.g. from a browser. The editor is
+	 * usually in the background then, so CPU throttling is disabled until the link and any asynchronous loading it
+	 * starts have finished, and the time taken is logged. Call EndReceiveLink once the link has been queued or rejected
+	 */
+	void BeginReceiveLink();
+	void EndReceiveLink();
+
+	/* @return true from when a link is received until it has executed */
+	bool IsReceivingLink() const { return LinkReceivedTime.IsSet(); }
+
+	/* @return the number of links waiting to be executed after the editor tick */
+	int32 GetNumQueuedLinks() const { return LinkInbox.IsValid() ? LinkInbox->Num() : 0; }
+	/* @return the number of links which can be queued before they're dropped */
+	int32 GetLinkInboxSpace() const
+	{
+		return LinkInbox.IsValid() ? FMath::Max(LinkInbox->GetCapacity() - LinkInbox->Num(), 0) : 0;
+	}
+
+	/* @return the number of definitions whose initialization is deferred until their menus are opened */
+	int32 GetNumDeferredDefinitions() const { return UninitializedDefinitions.Num(); }
+
+	/*
+	 * Decode, queue and dispatch links as normal but don't pass them to their definitions, so the link server can be
+	 * load tested without opening anything
+	 */
+	void SetDryRun(const bool bInDryRun) { bDryRun = bInDryRun; }
+	bool IsDryRun() const { return bDryRun; }
+
+	/* Broadcast on the game thread when a link reaches its definition, including in a dry run */
+	FOnHyperlinkDispatched& OnLinkDispatched() { return LinkDispatchedDelegate; }
 #endif //WITH_EDITOR
 
+	/* Update the definitions to match the settings. Only definitions which were added, removed or renamed change */
 	void RefreshDefinitions();
 
+	/* @return true once the definitions registered in the settings have been created */
+	bool AreDefinitionsInitialized() const { return bDefinitionsInitialized; }
+
+	/* Recreate the link store using the current settings */
+	void ResetLinkStore();
+
+	/* @return the link store, nullptr if disabled in settings */
+	FHyperlinkLinkStore* GetLinkStore() const { return LinkStore.Get(); }
+	/* @return the link store, kept alive for use on other threads */
+	TSharedPtr<FHyperlinkLinkStore, ESPMode::ThreadSafe> GetSharedLinkStore() const { return LinkStore; }
+
+	/*
+	 * @return the registered definitions. Lock free and thread safe, the snapshot can be kept and read from any thread
+	 */
+	TSharedRef<const FHyperlinkDefinitionSnapshot, ESPMode::ThreadSafe> GetDefinitionSnapshot() const;
+
 	/**
 	 * @tparam T the class of the desired definition
 	 * @return the requested definition, nullptr if not registered
@@ -39,29 +155,77 @@ public:
 	template<typename T>
 	T* GetDefinition() const
 	{
-		return GetDefinition(T::StaticClass());
+		return Cast<T>(GetDefinition(T::StaticClass()));
 	}
 
 	UHyperlinkDefinition* GetDefinition(const TSubclassOf<UHyperlinkDefinition> DefinitionClass) const;
+
+	/**
+	 * @param Identifier the identifier the definition is registered with
+	 * @return the requested definition, nullptr if not registered
+	 */
+	UHyperlinkDefinition* GetDefinition(const FString& Identifier) const;
+
+	/**
+	 * As GetDefinition, but a Blueprint definition whose class hasn't loaded yet is loaded and created
+	 * @param Identifier the identifier the definition is registered with
+	 * @return the requested definition, nullptr if not registered
+	 */
+	UHyperlinkDefinition* LoadDefinition(const FString& Identifier);
+
+	/**
+	 * @param DefinitionClass the exact class of the definition
+	 * @return the identifier the definition class is registered with, empty if not registered
+	 */
+	FString FindIdentifier(const UClass* DefinitionClass) const;
 	
 private:
-	void InitDefinitions();
+	/**
+	 * @brief Create definitions newly registered in the settings, move renamed definitions to their new identifier and
+	 * deinitialize the definitions which were removed or disabled
+	 * @return true if any definition changed
+	 */
+	bool UpdateDefinitions();
 	void DeinitDefinitions();
+	void PublishDefinitionSnapshot();
+	/* Destroy replaced snapshots once no reader can be about to take a reference to one */
+	void ReleaseRetiredSnapshots();
 	
 	void HelpConsole(const TArray<FString>& Args);
 	void CopyLinkConsole(const TArray<FString>& Args);
+	void CopyLinksConsole(const TArray<FString>& Args);
+	void LinkCacheStatsConsole() const;
+	static void StartupReportConsole();
+
+	/* Initialize or deinitialize a definition, measured by the startup profiler */
+	void InitializeDefinition(UHyperlinkDefinition* Definition);
+	void DeinitializeDefinition(UHyperlinkDefinition* Definition);
 #if WITH_EDITOR
 	void ExecuteLinkConsole(const TArray<FString>& Args);
-	void ExecuteLinkDeferred(FHyperlinkExecutePayload ExecutePayload) const;
-	
-	// TODO: move this to utility?
-	/**
-	 * @brief Attempts to extract a JSON substring from the provided string and deserialize it
-	 * @param InString InString String which contains a JSON substring
-	 * @param OutPayload Deserialized payload object
-	 * @return true if operation was successful
+	void ExecuteLinkDeferred(FHyperlinkExecutePayload ExecutePayload);
+	void ExecuteBundleDeferred(const TArray<FHyperlinkExecutePayload>& Payloads);
+
+	/* Execute queued links after the editor tick until the frame's time budget is spent */
+	void DrainLinkInbox(float DeltaTime);
+
+	/* Restore CPU throttling once every received link has executed */
+	void UpdateReceivingLink();
+
+	/* @return the definition for the payload's identifier, or class for links without one */
+	UHyperlinkDefinition* FindPayloadDefinition(const FHyperlinkExecutePayload& ExecutePayload);
+
+	/*
+	 * Load the classes of registered Blueprint definitions in the background, then create their definitions. Only if
+	 * enabled in settings, otherwise each class is loaded by LoadDefinition when first needed
 	 */
-	static bool TryGetPayloadFromString(const FString& InString, FHyperlinkExecutePayload& OutPayload);
+	void LoadUnloadedClassesAsync();
+
+	/* Initialize a new definition, or if deferred initialization is enabled add placeholders to its menus */
+	void InitializeOrDeferDefinition(UHyperlinkDefinition* Definition);
+	/* Initialize a definition whose initialization was deferred, does nothing if already initialized */
+	void InitializeDeferredDefinition(UHyperlinkDefinition* Definition);
+	/* Placeholder menu section which initializes the deferred definitions extending the menu */
+	void OnDeferredMenuGenerated(UToolMenu* InMenu, FName MenuName);
 #endif //WITH_EDITOR
 
 private:
@@ -69,7 +233,58 @@ private:
 	TMap<FString, TObjectPtr<UHyperlinkDefinition>> Definitions{};
 
 	TArray<IConsoleObject*> ConsoleCommands{ nullptr };
+
+	/* Shared so it stays alive while other threads decode links */
+	TSharedPtr<FHyperlinkLinkStore, ESPMode::ThreadSafe> LinkStore{ nullptr };
+
+	/*
+	 * The current snapshot, indexing Definitions. Only replaced on the game thread, readers on other threads load
+	 * PublishedSnapshot instead, which is swapped in one step so they never see a partial refresh
+	 */
+	TSharedRef<const FHyperlinkDefinitionSnapshot, ESPMode::ThreadSafe> DefinitionSnapshot
+		{ MakeShared<FHyperlinkDefinitionSnapshot, ESPMode::ThreadSafe>() };
+	std::atomic<const FHyperlinkDefinitionSnapshot*> PublishedSnapshot{ &DefinitionSnapshot.Get() };
+	/* Readers which have loaded PublishedSnapshot but may not have taken a reference to it yet */
+	mutable std::atomic<int32> NumSnapshotReaders{ 0 };
+	/* Replaced snapshots, kept alive until no reader can be about to take a reference to one */
+	TArray<TSharedRef<const FHyperlinkDefinitionSnapshot, ESPMode::ThreadSafe>> RetiredSnapshots{};
+	bool bDefinitionsInitialized{ false };
 #if WITH_EDITOR
 	FDelegateHandle PostEditorTickHandle{};
+
+	TUniquePtr<FHyperlinkLinkInbox> LinkInbox{ nullptr };
+
+	/*
+	 * When each recently queued link was queued, so duplicates arriving in the same burst only execute once. Links
+	 * are forgotten after a short window so sending the same link again later executes it. Guarded by
+	 * RecentPayloadsLock as links are queued from any thread
+	 */
+	TMap<TTuple<FString, const UClass*, FString>, double> RecentPayloads{};
+	int32 NumCoalescedPayloads{ 0 };
+	FCriticalSection RecentPayloadsLock{};
+
+	/* Registered definitions whose class isn't loaded yet, by identifier */
+	TMap<FString, TSoftClassPtr<UHyperlinkDefinition>> UnloadedClasses{};
+	TSet<FSoftObjectPath> RequestedClassPaths{};
+
+	/* Definitions created but not yet initialized. Kept alive by Definitions */
+	TSet<UHyperlinkDefinition*> UninitializedDefinitions{};
+	/* Menus which have a placeholder section for deferred definitions */
+	TSet<FName> DeferredMenuNames{};
+
+	/* Keeps the packages of the loading bundle in memory until it has executed */
+	TSharedPtr<FStreamableHandle> BundleLoadHandle{ nullptr };
+	/* Bundle whose packages have loaded, executed after the editor tick */
+	TOptional<TArray<FHyperlinkExecutePayload>> LoadedBundle{};
+	bool bExecutingBundle{ false };
+
+	bool bDryRun{ false };
+	FOnHyperlinkDispatched LinkDispatchedDelegate{};
+
+	FDelegateHandle ThrottlingHandle{};
+	/* When the first link handled since the editor was last throttled was received */
+	TOptional<double> LinkReceivedTime{};
+	/* Links received which haven't been queued or rejected yet */
+	int32 NumReceivingLinks{ 0 };
 #endif //WITH_EDITOR
 };
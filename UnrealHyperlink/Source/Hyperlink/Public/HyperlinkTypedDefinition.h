@@ -0,0 +1,148 @@
+﻿// Copyright (c) 2023-2024 Fergus Brown. Licensed under the MIT license. See "LICENSE" file for details.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HyperlinkPayloadCodec.h"
+#include "JsonObjectConverter.h"
+
+/**
+ * Base for definitions with a single USTRUCT payload. The payload is written to and read from links using
+ * THyperlinkPayloadCodec so no FJsonObject is created when copying or executing a link.
+ * UHT doesn't allow a template as the parent of a UCLASS, so inherit from this alongside UHyperlinkDefinition and add
+ * HYPERLINK_TYPED_DEFINITION_BODY() to the class to implement the UHyperlinkDefinition payload functions e.g.
+ *
+ * UCLASS()
+ * class UMyDefinition : public UHyperlinkDefinition, public THyperlinkTypedDefinition<FMyPayload>
+ * {
+ *	GENERATED_BODY()
+ *	HYPERLINK_TYPED_DEFINITION_BODY()
+ *
+ * public:
+ *	virtual bool GenerateTypedPayload(const TArray<FString>& Args, FMyPayload& OutPayload) const override;
+ *	virtual void ExecuteTypedPayload(const FMyPayload& InPayload) override;
+ * };
+ */
+template<typename TPayload>
+class THyperlinkTypedDefinition
+{
+public:
+	using FPayloadType = TPayload;
+
+	virtual ~THyperlinkTypedDefinition() = default;
+
+	/* Fill the payload using provided arguments or otherwise the current editor/game state */
+	virtual bool GenerateTypedPayload(const TArray<FString>& Args, TPayload& OutPayload) const = 0;
+
+	/* Fill a payload for each selected item. By default this generates a single payload with GenerateTypedPayload */
+	virtual bool GenerateTypedPayloads(const TArray<FString>& Args, TArray<TPayload>& OutPayloads) const
+	{
+		TPayload PayloadStruct{};
+		const bool bResult{ GenerateTypedPayload(Args, PayloadStruct) };
+		if (bResult)
+		{
+			OutPayloads.Emplace(MoveTemp(PayloadStruct));
+		}
+		return bResult;
+	}
+
+#if WITH_EDITOR
+	virtual void ExecuteTypedPayload(const TPayload& InPayload) = 0;
+
+	/* Add the packages which must be loaded to execute the payload */
+	virtual void GetTypedPayloadDependencies(const TPayload& InPayload, TArray<FName>& OutPackageNames) const {}
+#endif //WITH_EDITOR
+
+protected:
+	/* Implementations of the UHyperlinkDefinition payload functions used by HYPERLINK_TYPED_DEFINITION_BODY */
+	TSharedPtr<FJsonObject> GenerateTypedPayloadObject(const TArray<FString>& Args) const
+	{
+		TSharedPtr<FJsonObject> Payload{ nullptr };
+		TPayload PayloadStruct{};
+		if (GenerateTypedPayload(Args, PayloadStruct))
+		{
+			Payload = FJsonObjectConverter::UStructToJsonObject(PayloadStruct);
+		}
+		return Payload;
+	}
+
+	bool GenerateTypedPayloadString(const TArray<FString>& Args, FString& OutPayloadString) const
+	{
+		TPayload PayloadStruct{};
+		return GenerateTypedPayload(Args, PayloadStruct)
+			&& THyperlinkPayloadCodec<TPayload>::Write(PayloadStruct, OutPayloadString);
+	}
+
+	bool GenerateTypedPayloadStrings(const TArray<FString>& Args, TArray<FString>& OutPayloadStrings) const
+	{
+		TArray<TPayload> PayloadStructs{};
+		bool bResult{ GenerateTypedPayloads(Args, PayloadStructs) };
+		
+		OutPayloadStrings.Reserve(OutPayloadStrings.Num() + PayloadStructs.Num());
+		for (const TPayload& PayloadStruct : PayloadStructs)
+		{
+			FString& PayloadString{ OutPayloadStrings.AddDefaulted_GetRef() };
+			bResult &= THyperlinkPayloadCodec<TPayload>::Write(PayloadStruct, PayloadString);
+		}
+		return bResult;
+	}
+
+#if WITH_EDITOR
+	void ExecuteTypedPayloadObject(const TSharedRef<FJsonObject>& InPayload)
+	{
+		TPayload PayloadStruct{};
+		if (FJsonObjectConverter::JsonObjectToUStruct(InPayload, &PayloadStruct))
+		{
+			ExecuteTypedPayload(PayloadStruct);
+		}
+	}
+
+	bool ExecuteTypedPayloadString(const FStringView InPayloadString)
+	{
+		TPayload PayloadStruct{};
+		const bool bResult{ THyperlinkPayloadCodec<TPayload>::Read(InPayloadString, PayloadStruct) };
+		if (bResult)
+		{
+			ExecuteTypedPayload(PayloadStruct);
+		}
+		return bResult;
+	}
+
+	void GetTypedPayloadStringDependencies(const FStringView InPayloadString, TArray<FName>& OutPackageNames) const
+	{
+		TPayload PayloadStruct{};
+		if (THyperlinkPayloadCodec<TPayload>::Read(InPayloadString, PayloadStruct))
+		{
+			GetTypedPayloadDependencies(PayloadStruct, OutPackageNames);
+		}
+	}
+#endif //WITH_EDITOR
+};
+
+#if WITH_EDITOR
+#define HYPERLINK_TYPED_DEFINITION_BODY() \
+public: \
+	virtual TSharedPtr<FJsonObject> GeneratePayload(const TArray<FString>& Args) const override \
+		{ return GenerateTypedPayloadObject(Args); } \
+	virtual bool GeneratePayloadString(const TArray<FString>& Args, FString& OutPayloadString) const override \
+		{ return GenerateTypedPayloadString(Args, OutPayloadString); } \
+	virtual bool GeneratePayloadStrings(const TArray<FString>& Args, TArray<FString>& OutPayloadStrings) const override \
+		{ return GenerateTypedPayloadStrings(Args, OutPayloadStrings); } \
+	virtual void ExecutePayload(const TSharedRef<FJsonObject>& InPayload) override \
+		{ ExecuteTypedPayloadObject(InPayload); } \
+	virtual bool ExecutePayloadString(const FStringView InPayloadString) override \
+		{ return ExecuteTypedPayloadString(InPayloadString); } \
+	virtual void GetPayloadDependencies(const FStringView InPayloadString, TArray<FName>& OutPackageNames) const override \
+		{ GetTypedPayloadStringDependencies(InPayloadString, OutPackageNames); } \
+private:
+#else
+#define HYPERLINK_TYPED_DEFINITION_BODY() \
+public: \
+	virtual TSharedPtr<FJsonObject> GeneratePayload(const TArray<FString>& Args) const override \
+		{ return GenerateTypedPayloadObject(Args); } \
+	virtual bool GeneratePayloadString(const TArray<FString>& Args, FString& OutPayloadString) const override \
+		{ return GenerateTypedPayloadString(Args, OutPayloadString); } \
+	virtual bool GeneratePayloadStrings(const TArray<FString>& Args, TArray<FString>& OutPayloadStrings) const override \
+		{ return GenerateTypedPayloadStrings(Args, OutPayloadStrings); } \
+private:
+#endif //WITH_EDITOR
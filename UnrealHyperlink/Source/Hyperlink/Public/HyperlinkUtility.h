@@ -6,6 +6,7 @@
 
 class UHyperlinkDefinition;
 class FJsonObject;
+struct FAssetData;
 
 /**
  * 
@@ -15,18 +16,63 @@ class HYPERLINK_API FHyperlinkUtility
 
 public:
 	/* LINK HANDLING UTILITY */
+	
+	/* The start of every link. Cached until ResetLinkBaseAddress is called */
 	static FString GetLinkBaseAddress();
 	static FString GetLinkStructureHint();
 	
+	/* Call when the project identifier or local server port changes */
+	static void ResetLinkBaseAddress();
+	
+	/**
+	 * Create a link for a payload. Links are cached by definition class and payload so creating the same link again is
+	 * a lookup
+	 */
 	static FString CreateLinkFromPayload(TSubclassOf<UHyperlinkDefinition> DefinitionClass,
 		const TSharedRef<FJsonObject>& InPayload);
+	/* Create a link from a payload which has already been written as a JSON object string */
+	static FString CreateLinkFromPayload(TSubclassOf<UHyperlinkDefinition> DefinitionClass,
+		FStringView InPayloadString);
 
-	/* Simple approach to escaping special characters in the URL (Based on FGLTFFileBuilder::EncodeURI, thanks!)
-	 * CAUTION: Prefer the implementation of this function in UHyperlinkPythonBridge which has what should be a
-	 * more complete approach to escaping the URL.
+	/**
+	 * @brief Create a link for each payload. The definition, settings and link buffer are only looked up once for
+	 * the batch and the links aren't cached
+	 * @param DefinitionClass Definition used for every link
+	 * @param InPayloadStrings Payloads which have already been written as JSON object strings
+	 * @return A link for each payload, empty if the definition class is invalid
 	 */
-	static FString EscapeUrlString(const FString& InString);
+	static TArray<FString> CreateLinksFromPayloads(TSubclassOf<UHyperlinkDefinition> DefinitionClass,
+		TConstArrayView<FString> InPayloadStrings);
+
+	struct FLinkCacheStats
+	{
+		uint64 NumHits{ 0 };
+		uint64 NumMisses{ 0 };
+		int32 NumEntries{ 0 };
+	};
 	
+	/* Clear cached links. Call when anything other than the payload which affects links changes */
+	static void ResetLinkCache();
+	static FLinkCacheStats GetLinkCacheStats();
+
+	/**
+	 * @brief Percent-encode special characters in the URL (RFC 3986). The output matches python's
+	 * urllib.parse.quote: unreserved characters and '/' are kept and everything else is escaped as UTF-8 bytes
+	 * @param InString String to escape
+	 * @return The escaped string
+	 */
+	static FString EscapeUrlString(FStringView InString);
+	static void EscapeUrlString(FStringView InString, FStringBuilderBase& OutBuilder);
+
+	/**
+	 * @brief Decode any escaped characters in the URL. The output matches python's urllib.parse.unquote: runs of
+	 * escaped bytes are decoded as UTF-8 and invalid escape sequences are left untouched
+	 * @param InString String to decode
+	 * @return The decoded string
+	 */
+	static FString ParseUrlString(FStringView InString);
+	static void ParseUrlString(FStringView InString, FStringBuilderBase& OutBuilder);
+
 #if WITH_EDITOR
 	/* CODE ONLY UTILITY */
 
@@ -53,7 +99,25 @@ public:
 
 	/* EDITOR UTILITY */
 	
+	/* Load an asset, blocking until it has loaded. Prefer LoadObjectAsync when handling links */
 	static UObject* LoadObject(const FString& PackageName);
+
+	/**
+	 * @brief Load an asset without blocking the editor. The asset's hard dependencies are found in the asset registry
+	 * and requested at a higher priority so they load in parallel, with a cancellable notification showing progress.
+	 * Starting a load supersedes any pending ones, except while a bundle executes so each of its links opens. Assets
+	 * which are already fully loaded (e.g. by a bundle) call OnLoaded immediately
+	 * @param PackageName Package name of the asset to load
+	 * @param OnLoaded Called after the editor tick with the loaded asset, nullptr on failure. Not called if the load is
+	 * cancelled or superseded
+	 */
+	static void LoadObjectAsync(const FString& PackageName, TFunction<void(UObject*)> OnLoaded);
+
+	/* Cancel every pending LoadObjectAsync */
+	static void CancelPendingLoad();
+
+	/* @return true until every pending LoadObjectAsync has called OnLoaded, or been cancelled */
+	static bool IsLoadPending();
 	
 	/**
 	 * @brief Open the asset editor for an asset or focus it if it's already open 
@@ -62,8 +126,26 @@ public:
 	 */
 	static UObject* OpenEditorForAsset(const FString& PackageName);
 	static UObject* OpenEditorForAsset(const FName& PackageName);
+
+	/**
+	 * @brief Load an asset with LoadObjectAsync then open the asset editor for it or focus it if it's already open
+	 * @param PackageName Package name of the asset we wish to open the editor for
+	 * @param OnOpened Called with the UObject the editor was opened for, nullptr if it couldn't be loaded
+	 */
+	static void OpenEditorForAssetAsync(const FName& PackageName, TFunction<void(UObject*)> OnOpened = nullptr);
 	
 	/* Use to create a nice display string for a class*/
 	static FString CreateClassDisplayString(const UClass* Class);
+	/**
+	 * @brief As above for the generated class of a Blueprint asset, without loading it. Gives the same string as the
+	 * UClass overload does for the loaded class
+	 * @param BlueprintAsset Asset data for the Blueprint, either from the asset registry or from the Blueprint itself
+	 * @return The display string, empty if the asset has no generated class
+	 */
+	static FString CreateBlueprintClassDisplayString(const FAssetData& BlueprintAsset);
+
+private:
+	static void OpenEditorForLoadedAsset(const FString& PackageName, UObject* Object);
+	static FString CreateDisplayStringFromDisplayName(FString Identifier);
 #endif //WITH_EDITOR
 };
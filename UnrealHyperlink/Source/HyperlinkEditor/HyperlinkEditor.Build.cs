@@ -36,6 +36,7 @@ public class HyperlinkEditor : ModuleRules
                 "PythonScriptPlugin",
                 "Slate",
                 "SlateCore",
+                "Sockets",
                 "UnrealEd",
             }
         );
@@ -3,8 +3,8 @@
 
 #include "Definitions/HyperlinkLevelActor.h"
 
+#include "HyperlinkSubsystem.h"
 #include "HyperlinkUtility.h"
-#include "JsonObjectConverter.h"
 #include "LevelEditor.h"
 #include "LogHyperlinkEditor.h"
 #include "Selection.h"
@@ -24,6 +24,8 @@ void FHyperlinkLevelActorCommands::RegisterCommands()
 {
 	UI_COMMAND(CopyLevelActorLink, "Copy Actor Link", "Copy a link to focus the selected actor in the level editor",
 		EUserInterfaceActionType::Button, FInputChord(EModifierKey::Alt | EModifierKey::Shift, EKeys::C));
+	UI_COMMAND(CopyLevelActorLinks, "Copy Actor Links for Selection", "Copy a link to focus each of the selected actors in the level editor",
+		EUserInterfaceActionType::Button, FInputChord());
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -36,6 +38,10 @@ void UHyperlinkLevelActor::Initialize()
 		FHyperlinkLevelActorCommands::Get().CopyLevelActorLink,
 		FExecuteAction::CreateUObject(this, &UHyperlinkDefinition::CopyLink)
 	);
+	LevelActorCommands->MapAction(
+		FHyperlinkLevelActorCommands::Get().CopyLevelActorLinks,
+		FExecuteAction::CreateUObject(this, &UHyperlinkDefinition::CopyLinks)
+	);
 
 	const FLevelEditorModule& LevelEditor{ FModuleManager::LoadModuleChecked<FLevelEditorModule>(TEXT("LevelEditor")) };
 	LevelEditor.GetGlobalLevelEditorActions()->Append(LevelActorCommands.ToSharedRef());
@@ -46,6 +52,12 @@ void UHyperlinkLevelActor::Initialize()
 
 	FHyperlinkUtility::AddHyperlinkMenuEntry(TEXT("LevelEditor.LevelEditorSceneOutliner.ContextMenu"),
 	LevelActorCommands, FHyperlinkLevelActorCommands::Get().CopyLevelActorLink);
+
+	FHyperlinkUtility::AddHyperlinkMenuEntry(TEXT("LevelEditor.ActorContextMenu"),
+	LevelActorCommands, FHyperlinkLevelActorCommands::Get().CopyLevelActorLinks);
+
+	FHyperlinkUtility::AddHyperlinkMenuEntry(TEXT("LevelEditor.LevelEditorSceneOutliner.ContextMenu"),
+	LevelActorCommands, FHyperlinkLevelActorCommands::Get().CopyLevelActorLinks);
 }
 
 void UHyperlinkLevelActor::Deinitialize()
@@ -53,20 +65,24 @@ void UHyperlinkLevelActor::Deinitialize()
 	FHyperlinkLevelActorCommands::Unregister();
 }
 
-TSharedPtr<FJsonObject> UHyperlinkLevelActor::GeneratePayload(const TArray<FString>& Args) const
+bool UHyperlinkLevelActor::GetDeferredInitializeMenus(TArray<FName>& OutMenuNames) const
+{
+	OutMenuNames.Emplace(TEXT("LevelEditor.ActorContextMenu"));
+	OutMenuNames.Emplace(TEXT("LevelEditor.LevelEditorSceneOutliner.ContextMenu"));
+	return true;
+}
+
+bool UHyperlinkLevelActor::GenerateTypedPayload(const TArray<FString>& Args, FHyperlinkLevelActorPayload& OutPayload) const
 {
-	TSharedPtr<FJsonObject> Payload{ nullptr };
+	bool bResult{ false };
 	
 	if (const USelection* const Selection{ GEditor->GetSelectedActors() })
 	{
 		if (Selection->Num() > 0)
 		{
-			const FHyperlinkLevelActorPayload PayloadStruct
-			{
-				GEditor->GetEditorWorldContext().World()->PersistentLevel->GetPackage()->GetFName(),
-				Selection->GetSelectedObject(0)->GetFName()
-			};
-			Payload = FJsonObjectConverter::UStructToJsonObject(PayloadStruct);
+			OutPayload.LevelPackageName = GEditor->GetEditorWorldContext().World()->PersistentLevel->GetPackage()->GetFName();
+			OutPayload.ActorName = Selection->GetSelectedObject(0)->GetFName();
+			bResult = true;
 		}
 		else
 		{
@@ -74,21 +90,59 @@ TSharedPtr<FJsonObject> UHyperlinkLevelActor::GeneratePayload(const TArray<FStri
 		}
 	}
 	
-	return Payload;
+	return bResult;
 }
 
-void UHyperlinkLevelActor::ExecutePayload(const TSharedRef<FJsonObject>& InPayload)
+bool UHyperlinkLevelActor::GenerateTypedPayloads(const TArray<FString>& Args,
+	TArray<FHyperlinkLevelActorPayload>& OutPayloads) const
 {
-	FHyperlinkLevelActorPayload PayloadStruct{};
-	if (FJsonObjectConverter::JsonObjectToUStruct(InPayload, &PayloadStruct))
+	bool bResult{ false };
+	
+	if (const USelection* const Selection{ GEditor->GetSelectedActors() })
 	{
-		const FName& LevelPackageName{ PayloadStruct.LevelPackageName };
-		const FName& ActorName{ PayloadStruct.ActorName };
+		if (Selection->Num() > 0)
+		{
+			const FName LevelPackageName{ GEditor->GetEditorWorldContext().World()->PersistentLevel->GetPackage()->GetFName() };
+			OutPayloads.Reserve(OutPayloads.Num() + Selection->Num());
+			for (int32 Index{ 0 }; Index < Selection->Num(); ++Index)
+			{
+				if (const UObject* const SelectedActor{ Selection->GetSelectedObject(Index) })
+				{
+					OutPayloads.Emplace(FHyperlinkLevelActorPayload{ LevelPackageName, SelectedActor->GetFName() });
+					bResult = true;
+				}
+			}
+		}
+		else
+		{
+			UE_LOG(LogHyperlinkEditor, Error, TEXT("Could not generate actor links: no actor selected"));
+		}
+	}
+	
+	return bResult;
+}
+
+void UHyperlinkLevelActor::ExecuteTypedPayload(const FHyperlinkLevelActorPayload& InPayload)
+{
+	const FName& LevelPackageName{ InPayload.LevelPackageName };
+	const FName& ActorName{ InPayload.ActorName };
+
+	// Actor links in a bundle add to the selection so the whole selection can be restored
+	const UHyperlinkSubsystem* const HyperlinkSubsystem{ GEngine->GetEngineSubsystem<UHyperlinkSubsystem>() };
+	const bool bAddToSelection{ HyperlinkSubsystem && HyperlinkSubsystem->IsExecutingBundle() };
 
-		FHyperlinkUtility::OpenEditorForAsset(LevelPackageName);
-		if (AActor* const ActorToSelect{ GEditor->SelectNamedActor(*ActorName.ToString()) })
+	FHyperlinkUtility::OpenEditorForAssetAsync(LevelPackageName, [ActorName, bAddToSelection](const UObject* const Level)
+	{
+		if (!Level)
+		{
+			// Failure already logged by the load
+		}
+		else if (AActor* const ActorToSelect{ GEditor->SelectNamedActor(*ActorName.ToString()) })
 		{
-			GEditor->SelectNone(true, true);
+			if (!bAddToSelection)
+			{
+				GEditor->SelectNone(true, true);
+			}
 			GEditor->SelectActor(ActorToSelect, true, true);
 			GEditor->MoveViewportCamerasToActor(*ActorToSelect, true);
 		}
@@ -96,5 +150,11 @@ void UHyperlinkLevelActor::ExecutePayload(const TSharedRef<FJsonObject>& InPaylo
 		{
 			UE_LOG(LogHyperlinkEditor, Error, TEXT("Could not find actor named %s"), *ActorName.ToString());
 		}
-	}
+	});
+}
+
+void UHyperlinkLevelActor::GetTypedPayloadDependencies(const FHyperlinkLevelActorPayload& InPayload,
+	TArray<FName>& OutPackageNames) const
+{
+	OutPackageNames.Emplace(InPayload.LevelPackageName);
 }
@@ -5,6 +5,7 @@
 
 #include "BlueprintEditor.h"
 #include "GraphEditorModule.h"
+#include "HyperlinkPayloadCodec.h"
 #include "HyperlinkUtility.h"
 #include "IMaterialEditor.h"
 #include "JsonObjectConverter.h"
@@ -81,6 +82,27 @@ void UHyperlinkNode::Deinitialize()
 TSharedPtr<FJsonObject> UHyperlinkNode::GeneratePayload(const TArray<FString>& Args) const
 {
 	TSharedPtr<FJsonObject> Payload{ nullptr };
+	VisitSelectedNodePayload([&Payload](const auto& PayloadStruct)
+	{
+		Payload = FJsonObjectConverter::UStructToJsonObject(PayloadStruct);
+		return Payload.IsValid();
+	});
+	return Payload;
+}
+
+bool UHyperlinkNode::GeneratePayloadString(const TArray<FString>& Args, FString& OutPayloadString) const
+{
+	return VisitSelectedNodePayload([&OutPayloadString](const auto& PayloadStruct)
+	{
+		using FPayloadType = std::decay_t<decltype(PayloadStruct)>;
+		return THyperlinkPayloadCodec<FPayloadType>::Write(PayloadStruct, OutPayloadString);
+	});
+}
+
+template<typename TVisitor>
+bool UHyperlinkNode::VisitSelectedNodePayload(TVisitor&& Visitor) const
+{
+	bool bResult{ false };
 
 	if (SelectedNode.IsValid() && ActiveGraph.IsValid())
 	{
@@ -89,12 +111,18 @@ TSharedPtr<FJsonObject> UHyperlinkNode::GeneratePayload(const TArray<FString>& A
 		// Handle material and material functions differently
 		if (const UMaterial* const Material{ Cast<UMaterial>(AssetObject) })
 		{
-			Payload = GenerateMaterialPayload(*Material, *SelectedNode);
+			FHyperlinkMaterialPayload PayloadStruct{};
+			bResult = TryMakeMaterialPayload(*Material, *SelectedNode, PayloadStruct) && Visitor(PayloadStruct);
 		}
 		else // UBlueprint
 		{
-			Payload = GenerateBlueprintPayload(AssetObject->GetPackage()->GetFName(), ActiveGraph->GraphGuid,
-				SelectedNode->NodeGuid);
+			const FHyperlinkBlueprintPayload PayloadStruct
+			{
+				AssetObject->GetPackage()->GetFName(),
+				ActiveGraph->GraphGuid,
+				SelectedNode->NodeGuid
+			};
+			bResult = Visitor(PayloadStruct);
 		}
 	}
 	else
@@ -102,37 +130,13 @@ TSharedPtr<FJsonObject> UHyperlinkNode::GeneratePayload(const TArray<FString>& A
 		UE_LOG(LogHyperlinkEditor, Display, TEXT("Cannot generate Node link: no graph editor node is selected."));
 	}
 
-	return Payload;
-}
-
-TSharedPtr<FJsonObject> UHyperlinkNode::GenerateBlueprintPayload(const FName& AssetPackageName, const FGuid& GraphGuid,
-																 const FGuid& NodeGuid)
-{
-	const FHyperlinkBlueprintPayload PayloadStruct
-	{
-		AssetPackageName,
-		GraphGuid,
-		NodeGuid
-	};
-	return FJsonObjectConverter::UStructToJsonObject(PayloadStruct);
-}
-
-TSharedPtr<FJsonObject> UHyperlinkNode::GenerateMaterialPayload(const FName& AssetPackageName, const FGuid& NodeGuid,
-                                                                const int32 NodeX, const int32 NodeY)
-{
-	const FHyperlinkMaterialPayload PayloadStruct
-	{
-		AssetPackageName,
-		NodeGuid,
-		NodeX,
-		NodeY
-	};
-	return FJsonObjectConverter::UStructToJsonObject(PayloadStruct);
+	return bResult;
 }
 
-TSharedPtr<FJsonObject> UHyperlinkNode::GenerateMaterialPayload(const UMaterial& InMaterial, const UEdGraphNode& InNode)
+/*static*/bool UHyperlinkNode::TryMakeMaterialPayload(const UMaterial& InMaterial, const UEdGraphNode& InNode,
+	FHyperlinkMaterialPayload& OutPayload)
 {
-	TSharedPtr<FJsonObject> Payload{ nullptr };
+	bool bResult{ false };
 
 	const TConstArrayView<TObjectPtr<UMaterialExpression>> MaterialExpressions{ InMaterial.GetExpressions() };
 	const TObjectPtr<UMaterialExpression>* const ExpressionPtr{ MaterialExpressions.FindByPredicate(
@@ -159,14 +163,16 @@ TSharedPtr<FJsonObject> UHyperlinkNode::GenerateMaterialPayload(const UMaterial&
 			{
 				const TObjectPtr<const UMaterialExpression> MaterialExpression{ *ExpressionPtr };
 				const TObjectPtr<const UObject> Material{ *MaterialPtr };
-				Payload = GenerateMaterialPayload(Material->GetPackage()->GetFName(),
-					MaterialExpression->MaterialExpressionGuid, MaterialExpression->MaterialExpressionEditorX,
-					MaterialExpression->MaterialExpressionEditorY);
+				OutPayload.MaterialPackageName = Material->GetPackage()->GetFName();
+				OutPayload.MaterialExpressionGuid = MaterialExpression->MaterialExpressionGuid;
+				OutPayload.ExpressionX = MaterialExpression->MaterialExpressionEditorX;
+				OutPayload.ExpressionY = MaterialExpression->MaterialExpressionEditorY;
+				bResult = true;
 			}
 		}
 	}	
 	
-	return Payload;
+	return bResult;
 }
 
 void UHyperlinkNode::ExecutePayload(const TSharedRef<FJsonObject>& InPayload)
@@ -187,75 +193,117 @@ void UHyperlinkNode::ExecutePayload(const TSharedRef<FJsonObject>& InPayload)
 	}
 }
 
+bool UHyperlinkNode::ExecutePayloadString(const FStringView InPayloadString)
+{
+	bool bResult{ true };
+	
+	// Strict reads so the payload type is determined by which properties are present, as in ExecutePayload
+	if (FHyperlinkBlueprintPayload BlueprintPayload{};
+		THyperlinkPayloadCodec<FHyperlinkBlueprintPayload>::Read(InPayloadString, BlueprintPayload, true))
+	{
+		ExecuteBlueprintPayload(BlueprintPayload);
+	}
+	else if (FHyperlinkMaterialPayload MaterialPayload{};
+			 THyperlinkPayloadCodec<FHyperlinkMaterialPayload>::Read(InPayloadString, MaterialPayload, true))
+	{
+		ExecuteMaterialPayload(MaterialPayload);
+	}
+	else
+	{
+		UE_LOG(LogHyperlinkEditor, Error, TEXT("Failed to execute node link: unsupported payload"));
+		bResult = false;
+	}
+	
+	return bResult;
+}
+
+void UHyperlinkNode::GetPayloadDependencies(const FStringView InPayloadString, TArray<FName>& OutPackageNames) const
+{
+	if (FHyperlinkBlueprintPayload BlueprintPayload{};
+		THyperlinkPayloadCodec<FHyperlinkBlueprintPayload>::Read(InPayloadString, BlueprintPayload, true))
+	{
+		OutPackageNames.Emplace(BlueprintPayload.BlueprintPackageName);
+	}
+	else if (FHyperlinkMaterialPayload MaterialPayload{};
+			 THyperlinkPayloadCodec<FHyperlinkMaterialPayload>::Read(InPayloadString, MaterialPayload, true))
+	{
+		OutPackageNames.Emplace(MaterialPayload.MaterialPackageName);
+	}
+}
+
 void UHyperlinkNode::ExecuteBlueprintPayload(const FHyperlinkBlueprintPayload& InPayload)
 {
-	const UObject* const EditedObject{ FHyperlinkUtility::OpenEditorForAsset(InPayload.BlueprintPackageName) };
-	if (const UBlueprint* const Blueprint{ Cast<UBlueprint>(EditedObject) })
+	FHyperlinkUtility::OpenEditorForAssetAsync(InPayload.BlueprintPackageName, [InPayload](const UObject* const EditedObject)
 	{
-		TArray<UEdGraph*> AllGraphs{};
-		Blueprint->GetAllGraphs(AllGraphs);
-		
-		if (UEdGraph** GraphPtr{ AllGraphs.FindByPredicate([&](const UEdGraph* const G)
-			{ return G->GraphGuid == InPayload.GraphGuid; }) })
+		if (const UBlueprint* const Blueprint{ Cast<UBlueprint>(EditedObject) })
 		{
-			UEdGraph* const Graph{ *GraphPtr };
-			const TSharedPtr<FBlueprintEditor> BlueprintEditor
-				{ StaticCastSharedPtr<FBlueprintEditor>(FToolkitManager::Get().FindEditorForAsset(Blueprint)) };
-			if (BlueprintEditor.IsValid())
+			TArray<UEdGraph*> AllGraphs{};
+			Blueprint->GetAllGraphs(AllGraphs);
+		
+			if (UEdGraph** GraphPtr{ AllGraphs.FindByPredicate([&](const UEdGraph* const G)
+				{ return G->GraphGuid == InPayload.GraphGuid; }) })
 			{
-				const TSharedPtr<SGraphEditor> SlateEditor{ BlueprintEditor->OpenGraphAndBringToFront(Graph) };
-
-				if (const TObjectPtr<UEdGraphNode>* NodePtr{ (*GraphPtr)->Nodes.FindByPredicate(
-					[&](const UEdGraphNode* const N){ return N->NodeGuid == InPayload.NodeGuid; }) })
+				UEdGraph* const Graph{ *GraphPtr };
+				const TSharedPtr<FBlueprintEditor> BlueprintEditor
+					{ StaticCastSharedPtr<FBlueprintEditor>(FToolkitManager::Get().FindEditorForAsset(Blueprint)) };
+				if (BlueprintEditor.IsValid())
 				{
-					BlueprintEditor->AddToSelection(*NodePtr);
-					SlateEditor->ZoomToFit(true);
+					const TSharedPtr<SGraphEditor> SlateEditor{ BlueprintEditor->OpenGraphAndBringToFront(Graph) };
+
+					if (const TObjectPtr<UEdGraphNode>* NodePtr{ (*GraphPtr)->Nodes.FindByPredicate(
+						[&](const UEdGraphNode* const N){ return N->NodeGuid == InPayload.NodeGuid; }) })
+					{
+						BlueprintEditor->AddToSelection(*NodePtr);
+						SlateEditor->ZoomToFit(true);
+					}
 				}
 			}
 		}
-	}
+	});
 }
 
 void UHyperlinkNode::ExecuteMaterialPayload(const FHyperlinkMaterialPayload& InPayload)
 {
-	const UObject* const EditedObject{ FHyperlinkUtility::OpenEditorForAsset(InPayload.MaterialPackageName) };
-	if (EditedObject->IsA<UMaterial>() || EditedObject->IsA<UMaterialFunction>())
+	FHyperlinkUtility::OpenEditorForAssetAsync(InPayload.MaterialPackageName, [InPayload](const UObject* const EditedObject)
 	{
-		const TSharedPtr<IMaterialEditor> MaterialEditor
-			{ StaticCastSharedPtr<IMaterialEditor>(FToolkitManager::Get().FindEditorForAsset(EditedObject)) };
-
-		if (MaterialEditor.IsValid())
+		if (EditedObject && (EditedObject->IsA<UMaterial>() || EditedObject->IsA<UMaterialFunction>()))
 		{
-			const UMaterial* const PreviewMaterial{ Cast<UMaterial>(MaterialEditor->GetMaterialInterface()) };
-	
-			const TConstArrayView<TObjectPtr<UMaterialExpression>> MaterialExpressions{ PreviewMaterial->GetExpressions() };
-			TArray<TObjectPtr<UMaterialExpression>> Expressions{ MaterialExpressions.FilterByPredicate(
-				[=](const TObjectPtr<UMaterialExpression> Expression)
-				{
-					return Expression->MaterialExpressionGuid == InPayload.MaterialExpressionGuid;
-				}
-			) };
+			const TSharedPtr<IMaterialEditor> MaterialEditor
+				{ StaticCastSharedPtr<IMaterialEditor>(FToolkitManager::Get().FindEditorForAsset(EditedObject)) };
 
-			if (Expressions.Num() > 0)
+			if (MaterialEditor.IsValid())
 			{
-				// Find closest to the provided coords
-				Expressions.Sort(
-					[&](const UMaterialExpression& A, const UMaterialExpression& B)
+				const UMaterial* const PreviewMaterial{ Cast<UMaterial>(MaterialEditor->GetMaterialInterface()) };
+	
+				const TConstArrayView<TObjectPtr<UMaterialExpression>> MaterialExpressions{ PreviewMaterial->GetExpressions() };
+				TArray<TObjectPtr<UMaterialExpression>> Expressions{ MaterialExpressions.FilterByPredicate(
+					[=](const TObjectPtr<UMaterialExpression> Expression)
 					{
-						auto SqDistFromNode = [&](const UMaterialExpression& Expression)
+						return Expression->MaterialExpressionGuid == InPayload.MaterialExpressionGuid;
+					}
+				) };
+
+				if (Expressions.Num() > 0)
+				{
+					// Find closest to the provided coords
+					Expressions.Sort(
+						[&](const UMaterialExpression& A, const UMaterialExpression& B)
 						{
-							const int32 dx{ Expression.MaterialExpressionEditorX - InPayload.ExpressionX };
-							const int32 dy{ Expression.MaterialExpressionEditorY - InPayload.ExpressionY };
-							return dx * dx + dy * dy;
-						};
+							auto SqDistFromNode = [&](const UMaterialExpression& Expression)
+							{
+								const int32 dx{ Expression.MaterialExpressionEditorX - InPayload.ExpressionX };
+								const int32 dy{ Expression.MaterialExpressionEditorY - InPayload.ExpressionY };
+								return dx * dx + dy * dy;
+							};
 
-						return SqDistFromNode(A) < SqDistFromNode(B);
-					});
+							return SqDistFromNode(A) < SqDistFromNode(B);
+						});
 
-				MaterialEditor->JumpToExpression(Expressions[0]);
+					MaterialEditor->JumpToExpression(Expressions[0]);
+				}
 			}
 		}
-	}
+	});
 }
 
 bool UHyperlinkNode::TryGetExtensionPoint(const UClass* const Class, FName& OutExtensionPoint)
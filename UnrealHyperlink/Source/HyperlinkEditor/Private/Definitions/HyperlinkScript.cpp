@@ -7,6 +7,7 @@
 #include "EditorUtilityBlueprint.h"
 #include "EditorUtilitySubsystem.h"
 #include "HyperlinkCommonPayload.h"
+#include "HyperlinkPayloadCodec.h"
 #include "HyperlinkPythonBridge.h"
 #include "HyperlinkUtility.h"
 #include "IContentBrowserSingleton.h"
@@ -51,6 +52,12 @@ void UHyperlinkScript::Deinitialize()
 	// TODO
 }
 
+bool UHyperlinkScript::GetDeferredInitializeMenus(TArray<FName>& OutMenuNames) const
+{
+	OutMenuNames.Emplace(TEXT("ContentBrowser.AssetContextMenu"));
+	return true;
+}
+
 TSharedPtr<FJsonObject> UHyperlinkScript::GeneratePayload(const TArray<FString>& Args) const
 {
 	TSharedPtr<FJsonObject> Payload{ nullptr };
@@ -67,6 +74,34 @@ TSharedPtr<FJsonObject> UHyperlinkScript::GeneratePayload(const TArray<FString>&
 	return Payload;
 }
 
+bool UHyperlinkScript::GeneratePayloadStrings(const TArray<FString>& Args, TArray<FString>& OutPayloadStrings) const
+{
+	bool bResult{ false };
+
+	if (Args.Num() > 0)
+	{
+		bResult = Super::GeneratePayloadStrings(Args, OutPayloadStrings);
+	}
+	else
+	{
+		// A link for every selected blutility
+		const TArray<FAssetData> Blutilities{ GetSelectedBlutilities() };
+		OutPayloadStrings.Reserve(OutPayloadStrings.Num() + Blutilities.Num());
+		for (const FAssetData& Blutility : Blutilities)
+		{
+			const FHyperlinkNamePayload PayloadStruct{ Blutility.PackageName };
+			FString& PayloadString{ OutPayloadStrings.AddDefaulted_GetRef() };
+			bResult = THyperlinkPayloadCodec<FHyperlinkNamePayload>::Write(PayloadStruct, PayloadString);
+			if (!bResult)
+			{
+				break;
+			}
+		}
+	}
+
+	return bResult;
+}
+
 void UHyperlinkScript::ExecutePayload(const TSharedRef<FJsonObject>& InPayload)
 {
 	FHyperlinkNamePayload PayloadStruct{};
@@ -80,17 +115,29 @@ void UHyperlinkScript::ExecutePayload(const TSharedRef<FJsonObject>& InPayload)
 		}
 		else // This is a path for a blutility
 		{
-			UObject* const LoadedBlutility{ FHyperlinkUtility::LoadObject(PayloadStruct.Name.ToString()) };
-
-			UEditorUtilitySubsystem* const EditorUtilitySubsystem{ GEditor->GetEditorSubsystem<UEditorUtilitySubsystem>() };
-			if (EditorUtilitySubsystem)
+			FHyperlinkUtility::LoadObjectAsync(PayloadStruct.Name.ToString(), [](UObject* const LoadedBlutility)
 			{
-				EditorUtilitySubsystem->TryRun(LoadedBlutility);
-			}
+				UEditorUtilitySubsystem* const EditorUtilitySubsystem{ GEditor->GetEditorSubsystem<UEditorUtilitySubsystem>() };
+				if (EditorUtilitySubsystem && LoadedBlutility)
+				{
+					EditorUtilitySubsystem->TryRun(LoadedBlutility);
+				}
+			});
 		}
 	}
 }
 
+void UHyperlinkScript::GetPayloadDependencies(const FStringView InPayloadString, TArray<FName>& OutPackageNames) const
+{
+	// Python scripts are run from disk, only blutilities need loading
+	FHyperlinkNamePayload PayloadStruct{};
+	if (THyperlinkPayloadCodec<FHyperlinkNamePayload>::Read(InPayloadString, PayloadStruct)
+		&& !PayloadStruct.Name.ToString().EndsWith(TEXT(".py")))
+	{
+		OutPackageNames.Emplace(PayloadStruct.Name);
+	}
+}
+
 TSharedPtr<FJsonObject> UHyperlinkScript::GenerateScriptPayload(FString ScriptPath)
 {
 	// Ensure the provided path only has forward slashes
@@ -113,26 +160,28 @@ TSharedPtr<FJsonObject> UHyperlinkScript::GeneratePayloadFromSelectedBlutility()
 {
 	TSharedPtr<FJsonObject> Payload{ nullptr };
 	
+	const TArray<FAssetData> FilteredAssets{ GetSelectedBlutilities() };
+	if (FilteredAssets.Num() > 0)
+	{
+		const FHyperlinkNamePayload PayloadStruct{ FilteredAssets[0].PackageName };
+		Payload = FJsonObjectConverter::UStructToJsonObject(PayloadStruct);
+	}
+
+	return Payload;
+}
+
+TArray<FAssetData> UHyperlinkScript::GetSelectedBlutilities()
+{
 	// TODO: implement this sort of content browser operation in utilities (get selected assets of type)
 	const FContentBrowserModule& ContentBrowser =
 		FModuleManager::LoadModuleChecked<FContentBrowserModule>(TEXT("ContentBrowser"));
 	TArray<FAssetData> SelectedAssets{};
 	ContentBrowser.Get().GetSelectedAssets(SelectedAssets);
 	
-	TArray<FAssetData> FilteredAssets
-	{
-		SelectedAssets.FilterByPredicate([](const FAssetData& AssetData)
+	return SelectedAssets.FilterByPredicate([](const FAssetData& AssetData)
 		{
 			return AssetData.AssetClassPath == UEditorUtilityBlueprint::StaticClass()->GetClassPathName();
-		})
-	};
-	if (SelectedAssets.Num() > 0 )
-	{
-		const FHyperlinkNamePayload PayloadStruct{ SelectedAssets[0].PackageName };
-		Payload = FJsonObjectConverter::UStructToJsonObject(PayloadStruct);
-	}
-
-	return Payload;
+		});
 }
 
 bool UHyperlinkScript::IsBlutilitySelected()
@@ -0,0 +1,375 @@
+﻿// Copyright (c) 2023-2024 Fergus Brown. Licensed under the MIT license. See "LICENSE" file for details.
+
+
+#include "HyperlinkBenchmark.h"
+
+#include "Definitions/HyperlinkEdit.h"
+#include "Definitions/HyperlinkLevelActor.h"
+#include "Definitions/HyperlinkNode.h"
+#include "Definitions/HyperlinkViewport.h"
+#include "Engine/Engine.h"
+#include "HAL/MemoryBase.h"
+#include "HyperlinkCommonPayload.h"
+#include "HyperlinkExecutePayload.h"
+#include "HyperlinkFormat.h"
+#include "HyperlinkPayloadCodec.h"
+#include "HyperlinkSubsystem.h"
+#include "HyperlinkUtility.h"
+#include "LogHyperlinkEditor.h"
+#include "Misc/EngineVersion.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/JsonSerializer.h"
+#include "UObject/StructOnScope.h"
+
+namespace FHyperlinkBenchmarkHelpers
+{
+	/* Forwards to the allocator it replaces, counting the allocations made by the thread which installed it */
+	class FCountingMalloc final : public FMalloc
+	{
+	public:
+		explicit FCountingMalloc(FMalloc* const InInner)
+			: Inner{ InInner }
+			, ThreadId{ FPlatformTLS::GetCurrentThreadId() }
+		{
+		}
+
+		virtual void* Malloc(const SIZE_T Count, const uint32 Alignment) override
+		{
+			CountAllocation();
+			return Inner->Malloc(Count, Alignment);
+		}
+
+		virtual void* TryMalloc(const SIZE_T Count, const uint32 Alignment) override
+		{
+			CountAllocation();
+			return Inner->TryMalloc(Count, Alignment);
+		}
+
+		virtual void* Realloc(void* const Original, const SIZE_T Count, const uint32 Alignment) override
+		{
+			CountAllocation();
+			return Inner->Realloc(Original, Count, Alignment);
+		}
+
+		virtual void* TryRealloc(void* const Original, const SIZE_T Count, const uint32 Alignment) override
+		{
+			CountAllocation();
+			return Inner->TryRealloc(Original, Count, Alignment);
+		}
+
+		virtual void Free(void* const Original) override { Inner->Free(Original); }
+		virtual SIZE_T QuantizeSize(const SIZE_T Count, const uint32 Alignment) override
+		{
+			return Inner->QuantizeSize(Count, Alignment);
+		}
+		virtual bool GetAllocationSize(void* const Original, SIZE_T& SizeOut) override
+		{
+			return Inner->GetAllocationSize(Original, SizeOut);
+		}
+		virtual void Trim(const bool bTrimThreadCaches) override { Inner->Trim(bTrimThreadCaches); }
+		virtual void SetupTLSCachesOnCurrentThread() override { Inner->SetupTLSCachesOnCurrentThread(); }
+		virtual void ClearAndDisableTLSCachesOnCurrentThread() override
+		{
+			Inner->ClearAndDisableTLSCachesOnCurrentThread();
+		}
+		virtual bool IsInternallyThreadSafe() const override { return Inner->IsInternallyThreadSafe(); }
+		virtual bool ValidateHeap() override { return Inner->ValidateHeap(); }
+		virtual const TCHAR* GetDescriptiveName() override { return Inner->GetDescriptiveName(); }
+
+		uint64 GetNumAllocations() const { return NumAllocations; }
+
+	private:
+		void CountAllocation()
+		{
+			// Only written by one thread, so this doesn't need to be atomic
+			if (FPlatformTLS::GetCurrentThreadId() == ThreadId)
+			{
+				++NumAllocations;
+			}
+		}
+
+		FMalloc* const Inner;
+		const uint32 ThreadId;
+		uint64 NumAllocations{ 0 };
+	};
+
+	/* Installs a counting allocator for the lifetime of the scope */
+	class FCountAllocationsScope
+	{
+	public:
+		FCountAllocationsScope()
+			: PreviousMalloc{ GMalloc }
+		{
+			// Other threads may still be inside the counting allocator after it is uninstalled, so it is never freed
+			static FCountingMalloc* const CountingMalloc{ new FCountingMalloc(GMalloc) };
+			Malloc = CountingMalloc;
+			GMalloc = CountingMalloc;
+		}
+
+		~FCountAllocationsScope()
+		{
+			GMalloc = PreviousMalloc;
+		}
+
+		FCountAllocationsScope(const FCountAllocationsScope&) = delete;
+		FCountAllocationsScope& operator=(const FCountAllocationsScope&) = delete;
+
+		uint64 GetNumAllocations() const { return Malloc->GetNumAllocations(); }
+
+	private:
+		FMalloc* const PreviousMalloc;
+		const FCountingMalloc* Malloc{ nullptr };
+	};
+
+	/* Nearest rank percentile of sorted samples */
+	static double GetPercentile(const TArray<double>& SortedSamples, const double Percentile)
+	{
+		const int32 Idx{ FMath::Clamp(FMath::CeilToInt(Percentile * SortedSamples.Num()) - 1, 0,
+			SortedSamples.Num() - 1) };
+		return SortedSamples.Num() > 0 ? SortedSamples[Idx] : 0.0;
+	}
+
+	struct FSample
+	{
+		const TCHAR* Name;
+		UClass* Class;
+		const UScriptStruct* Struct;
+		const void* Data;
+	};
+}
+
+/*static*/bool FHyperlinkBenchmark::Run(const int32 Iterations)
+{
+	TArray<FResult> Results{};
+	return Run(Iterations, Results);
+}
+
+/*static*/bool FHyperlinkBenchmark::Run(const int32 Iterations, TArray<FResult>& OutResults)
+{
+	bool bResult{ false };
+	
+	if (const UHyperlinkSubsystem* const HyperlinkSubsystem{ GEngine->GetEngineSubsystem<UHyperlinkSubsystem>() })
+	{
+		OutResults = RunCases(*HyperlinkSubsystem, Iterations);
+		const TArray<FResult>& Results{ OutResults };
+		
+		bResult = true;
+		FString Report{ FString::Printf(TEXT("%-48s %10s %12s %12s %12s %10s\n"), TEXT("Case"), TEXT("Iterations"),
+			TEXT("Min (us)"), TEXT("Median (us)"), TEXT("P99 (us)"), TEXT("Allocs")) };
+		for (const FResult& Result : Results)
+		{
+			Report.Appendf(TEXT("%-48s %10d %12.3f %12.3f %12.3f %10.1f%s\n"), *Result.Name, Result.Iterations,
+				Result.MinSeconds * 1.0e6, Result.MedianSeconds * 1.0e6, Result.P99Seconds * 1.0e6,
+				Result.AllocationsPerIteration, Result.bSucceeded ? TEXT("") : TEXT(" FAILED"));
+			bResult &= Result.bSucceeded;
+		}
+		UE_LOG(LogHyperlinkEditor, Display, TEXT("Hyperlink benchmark (%d cases):\n%s"), Results.Num(), *Report);
+		UE_CLOG(!bResult, LogHyperlinkEditor, Error, TEXT("Hyperlink benchmark had failing cases"));
+
+		bResult &= WriteReport(Results, Iterations);
+	}
+	else
+	{
+		UE_LOG(LogHyperlinkEditor, Error, TEXT("Cannot run benchmark: UHyperlinkSubsystem not yet initialised."));
+	}
+	
+	return bResult;
+}
+
+/*static*/TArray<FHyperlinkBenchmark::FResult> FHyperlinkBenchmark::RunCases(
+	const UHyperlinkSubsystem& HyperlinkSubsystem, const int32 Iterations)
+{
+	using namespace FHyperlinkBenchmarkHelpers;
+	
+	// Representative payload for each of the built-in payload types. The package exists in every project so decoded
+	// links pass the missing asset check
+	const FName PackageName{ TEXT("/Engine/BasicShapes/Cube") };
+	const FHyperlinkNamePayload NamePayload{ PackageName };
+	const FHyperlinkViewportPayload ViewportPayload{ PackageName, FVector(1024.5, -2048.25, 512.0),
+		FRotator(-15.0, 90.0, 0.0) };
+	const FHyperlinkBlueprintPayload BlueprintPayload{ PackageName, FGuid::NewGuid(), FGuid::NewGuid() };
+	const FHyperlinkMaterialPayload MaterialPayload{ PackageName, FGuid::NewGuid(), -1200, 350 };
+	const FHyperlinkLevelActorPayload LevelActorPayload{ PackageName, TEXT("StaticMeshActor_42") };
+	
+	const FSample Samples[]
+	{
+		{ TEXT("Name"), UHyperlinkEdit::StaticClass(), FHyperlinkNamePayload::StaticStruct(), &NamePayload },
+		{ TEXT("Viewport"), UHyperlinkViewport::StaticClass(), FHyperlinkViewportPayload::StaticStruct(),
+			&ViewportPayload },
+		{ TEXT("Blueprint"), UHyperlinkNode::StaticClass(), FHyperlinkBlueprintPayload::StaticStruct(),
+			&BlueprintPayload },
+		{ TEXT("Material"), UHyperlinkNode::StaticClass(), FHyperlinkMaterialPayload::StaticStruct(), &MaterialPayload },
+		{ TEXT("LevelActor"), UHyperlinkLevelActor::StaticClass(), FHyperlinkLevelActorPayload::StaticStruct(),
+			&LevelActorPayload },
+	};
+
+	TArray<FResult> Results{};
+	
+	// URL escaping has a fast path for strings which need no escaping
+	const FString UnescapedString
+		{ TEXT("HyperlinkBenchmark0123456789-abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ") };
+	const FString EscapedString{ FHyperlinkUtility::EscapeUrlString(
+		TEXT("{\"Name\":\"/Game/Maps/Example Map\",\"Location\":{\"X\":1024.5,\"Y\":-2048.25,\"Z\":512}}")) };
+	for (const FString* const String : { &UnescapedString, &EscapedString })
+	{
+		const TCHAR* const PathName{ String == &UnescapedString ? TEXT("Unescaped") : TEXT("Escaped") };
+		const FString ParsedString{ FHyperlinkUtility::ParseUrlString(*String) };
+		Results.Emplace(Measure(FString::Printf(TEXT("EscapeUrlString/%s"), PathName), Iterations, [&ParsedString]()
+		{
+			return !FHyperlinkUtility::EscapeUrlString(ParsedString).IsEmpty();
+		}));
+		Results.Emplace(Measure(FString::Printf(TEXT("ParseUrlString/%s"), PathName), Iterations, [String]()
+		{
+			return !FHyperlinkUtility::ParseUrlString(*String).IsEmpty();
+		}));
+	}
+
+	for (const FSample& Sample : Samples)
+	{
+		FString PayloadString{};
+		FHyperlinkPayloadCodec::WriteStruct(Sample.Struct, Sample.Data, PayloadString);
+		const FString Link{ FHyperlinkUtility::CreateLinkFromPayload(Sample.Class, PayloadString) };
+		const FString ParsedLink{ FHyperlinkUtility::ParseUrlString(Link) };
+		
+		Results.Emplace(Measure(FString::Printf(TEXT("WriteStruct/%s"), Sample.Name), Iterations, [&Sample]()
+		{
+			FString OutPayloadString{};
+			return FHyperlinkPayloadCodec::WriteStruct(Sample.Struct, Sample.Data, OutPayloadString);
+		}));
+		
+		FStructOnScope ReadStruct{ Sample.Struct };
+		Results.Emplace(Measure(FString::Printf(TEXT("ReadStruct/%s"), Sample.Name), Iterations,
+			[&Sample, &PayloadString, &ReadStruct]()
+		{
+			return FHyperlinkPayloadCodec::ReadStruct(PayloadString, Sample.Struct, ReadStruct.GetStructMemory());
+		}));
+		
+		// Repeated links are served from the link cache
+		Results.Emplace(Measure(FString::Printf(TEXT("CreateLinkFromPayload/Cached/%s"), Sample.Name), Iterations,
+			[&Sample, &PayloadString]()
+		{
+			return !FHyperlinkUtility::CreateLinkFromPayload(Sample.Class, PayloadString).IsEmpty();
+		}));
+		Results.Emplace(Measure(FString::Printf(TEXT("CreateLinkFromPayload/Uncached/%s"), Sample.Name), Iterations,
+			[&Sample, &PayloadString]()
+		{
+			return FHyperlinkUtility::CreateLinksFromPayloads(Sample.Class, MakeArrayView(&PayloadString, 1)).Num() == 1;
+		}));
+		
+		Results.Emplace(Measure(FString::Printf(TEXT("TryFindPayloadString/%s"), Sample.Name), Iterations,
+			[&ParsedLink]()
+		{
+			FStringView FoundPayloadString{};
+			return FHyperlinkFormat::TryFindPayloadString(ParsedLink, FoundPayloadString);
+		}));
+		
+		// Everything a link received by the HTTP server goes through before it is queued to execute
+		const TSharedRef<const FHyperlinkDefinitionSnapshot, ESPMode::ThreadSafe> Snapshot
+			{ HyperlinkSubsystem.GetDefinitionSnapshot() };
+		Results.Emplace(Measure(FString::Printf(TEXT("DecodeLink/%s"), Sample.Name), Iterations,
+			[&Link, &Snapshot, &Sample, &ReadStruct]()
+		{
+			FHyperlinkExecutePayload Payload{};
+			return UHyperlinkSubsystem::DecodeLink(Link, *Snapshot, nullptr, Payload) == EHyperlinkDecodeResult::Success
+				&& FHyperlinkPayloadCodec::ReadStruct(Payload.DefinitionPayload.JsonString, Sample.Struct,
+					ReadStruct.GetStructMemory());
+		}));
+	}
+
+	const FString EditIdentifier{ HyperlinkSubsystem.FindIdentifier(UHyperlinkEdit::StaticClass()) };
+	if (!EditIdentifier.IsEmpty())
+	{
+		Results.Emplace(Measure(TEXT("GetDefinition/Class"), Iterations, [&HyperlinkSubsystem]()
+		{
+			return HyperlinkSubsystem.GetDefinition(UHyperlinkEdit::StaticClass()) != nullptr;
+		}));
+		Results.Emplace(Measure(TEXT("GetDefinition/Identifier"), Iterations, [&HyperlinkSubsystem, &EditIdentifier]()
+		{
+			return HyperlinkSubsystem.GetDefinition(EditIdentifier) != nullptr;
+		}));
+	}
+	else
+	{
+		UE_LOG(LogHyperlinkEditor, Warning, TEXT("Skipped GetDefinition benchmarks, %s is not registered"),
+			*UHyperlinkEdit::StaticClass()->GetName());
+	}
+
+	return Results;
+}
+
+/*static*/FString FHyperlinkBenchmark::GetReportPath()
+{
+	return FPaths::ProjectSavedDir() / TEXT("Hyperlink") / TEXT("bench.json");
+}
+
+// NOLINTNEXTLINE(performance-unnecessary-value-param) : moved into the result
+/*static*/FHyperlinkBenchmark::FResult FHyperlinkBenchmark::Measure(FString Name, const int32 Iterations,
+	const TFunctionRef<bool()> Func)
+{
+	using namespace FHyperlinkBenchmarkHelpers;
+	
+	FResult Result{};
+	Result.Name = MoveTemp(Name);
+	Result.Iterations = Iterations;
+
+	// Fill caches and grow any containers the case reuses
+	for (int32 Idx{ 0 }; Idx < FMath::Max(Iterations / 10, 1); ++Idx)
+	{
+		Result.bSucceeded &= Func();
+	}
+
+	TArray<double> Samples{};
+	Samples.Reserve(Iterations);
+	uint64 NumAllocations{ 0 };
+	{
+		const FCountAllocationsScope AllocationsScope{};
+		const uint64 StartAllocations{ AllocationsScope.GetNumAllocations() };
+		for (int32 Idx{ 0 }; Idx < Iterations; ++Idx)
+		{
+			const uint64 StartCycles{ FPlatformTime::Cycles64() };
+			Result.bSucceeded &= Func();
+			Samples.Add(FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - StartCycles));
+		}
+		NumAllocations = AllocationsScope.GetNumAllocations() - StartAllocations;
+	}
+	
+	Samples.Sort();
+	Result.MinSeconds = GetPercentile(Samples, 0.0);
+	Result.MedianSeconds = GetPercentile(Samples, 0.5);
+	Result.P99Seconds = GetPercentile(Samples, 0.99);
+	Result.AllocationsPerIteration = Iterations > 0 ? static_cast<double>(NumAllocations) / Iterations : 0.0;
+
+	UE_CLOG(!Result.bSucceeded, LogHyperlinkEditor, Error, TEXT("Benchmark case %s failed"), *Result.Name);
+	return Result;
+}
+
+/*static*/bool FHyperlinkBenchmark::WriteReport(const TArray<FResult>& Results, const int32 Iterations)
+{
+	FString JsonString{};
+	const TSharedRef<TJsonWriter<>> JsonWriter{ TJsonWriterFactory<>::Create(&JsonString) };
+	JsonWriter->WriteObjectStart();
+	JsonWriter->WriteValue(TEXT("EngineVersion"), FEngineVersion::Current().ToString());
+	JsonWriter->WriteValue(TEXT("Platform"), FString(FPlatformProperties::IniPlatformName()));
+	JsonWriter->WriteValue(TEXT("Iterations"), Iterations);
+	JsonWriter->WriteArrayStart(TEXT("Cases"));
+	for (const FResult& Result : Results)
+	{
+		JsonWriter->WriteObjectStart();
+		JsonWriter->WriteValue(TEXT("Name"), Result.Name);
+		JsonWriter->WriteValue(TEXT("Succeeded"), Result.bSucceeded);
+		JsonWriter->WriteValue(TEXT("MinNanoseconds"), Result.MinSeconds * 1.0e9);
+		JsonWriter->WriteValue(TEXT("MedianNanoseconds"), Result.MedianSeconds * 1.0e9);
+		JsonWriter->WriteValue(TEXT("P99Nanoseconds"), Result.P99Seconds * 1.0e9);
+		JsonWriter->WriteValue(TEXT("AllocationsPerIteration"), Result.AllocationsPerIteration);
+		JsonWriter->WriteObjectEnd();
+	}
+	JsonWriter->WriteArrayEnd();
+	JsonWriter->WriteObjectEnd();
+	JsonWriter->Close();
+
+	const FString ReportPath{ GetReportPath() };
+	const bool bResult{ FFileHelper::SaveStringToFile(JsonString, *ReportPath) };
+	UE_CLOG(bResult, LogHyperlinkEditor, Display, TEXT("Wrote benchmark results to %s"), *ReportPath);
+	UE_CLOG(!bResult, LogHyperlinkEditor, Warning, TEXT("Could not write benchmark results to %s"), *ReportPath);
+	return bResult;
+}
@@ -0,0 +1,55 @@
+﻿// Copyright (c) 2023-2024 Fergus Brown. Licensed under the MIT license. See "LICENSE" file for details.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UHyperlinkSubsystem;
+
+/**
+ * Benchmarks of the link pipeline for the built-in payload types, run by the Hyperlink.Benchmark automation test and the
+ * uhl.Bench console command. Runs headless with e.g. -nullrhi -unattended -ExecCmds="Automation RunTests
+ * Hyperlink.Benchmark; Quit". Each case reports the min, median and p99 time of one iteration and the number of
+ * allocations it makes, and the results are written as JSON so runs can be compared
+ */
+class FHyperlinkBenchmark
+{
+public:
+	struct FResult
+	{
+		FString Name{};
+		int32 Iterations{ 0 };
+		double MinSeconds{ 0.0 };
+		double MedianSeconds{ 0.0 };
+		double P99Seconds{ 0.0 };
+		/* Allocations made by the game thread, averaged over the iterations */
+		double AllocationsPerIteration{ 0.0 };
+		bool bSucceeded{ true };
+	};
+
+	/**
+	 * @brief Run every case, log a table of the results and write them to GetReportPath()
+	 * @param Iterations Number of measured iterations of each case
+	 * @return true if every case succeeded and the report was written
+	 */
+	static bool Run(int32 Iterations);
+
+	/* As above, also returning the results so they can be checked against thresholds */
+	static bool Run(int32 Iterations, TArray<FResult>& OutResults);
+
+	/* @return the path Run writes to, "Saved/Hyperlink/bench.json" */
+	static FString GetReportPath();
+
+private:
+	static TArray<FResult> RunCases(const UHyperlinkSubsystem& HyperlinkSubsystem, int32 Iterations);
+
+	/**
+	 * @brief Time each iteration of a case after warming it up
+	 * @param Name Name of the case
+	 * @param Iterations Number of measured iterations
+	 * @param Func One iteration of the case, returns false if it failed
+	 */
+	static FResult Measure(FString Name, int32 Iterations, TFunctionRef<bool()> Func);
+
+	static bool WriteReport(const TArray<FResult>& Results, int32 Iterations);
+};
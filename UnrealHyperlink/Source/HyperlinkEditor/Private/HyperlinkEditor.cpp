@@ -3,18 +3,88 @@
 
 #include "HyperlinkEditor.h"
 
+#include "Async/Async.h"
 #include "Customization/HyperlinkSettingsCustomization.h"
+#include "Definitions/HyperlinkEdit.h"
+#include "Definitions/HyperlinkLevelActor.h"
+#include "Definitions/HyperlinkNode.h"
+#include "Definitions/HyperlinkViewport.h"
+#include "HyperlinkBenchmark.h"
+#include "Editor.h"
+#include "Framework/Application/SlateApplication.h"
 #include "HttpServerModule.h"
 #include "HttpServerRequest.h"
+#include "HyperlinkCommonPayload.h"
+#include "HyperlinkExecutePayload.h"
+#include "HyperlinkFormat.h"
+#include "HyperlinkIpcServer.h"
+#include "HyperlinkLoadTest.h"
+#include "HyperlinkMetrics.h"
+#include "HyperlinkPayloadCodec.h"
 #include "HyperlinkSettings.h"
+#include "HyperlinkStartupProfiler.h"
+#include "HyperlinkStats.h"
 #include "HyperlinkSubsystem.h"
+#include "HyperlinkUtility.h"
 #include "IHttpRouter.h"
 #include "Interfaces/IMainFrameModule.h"
+#include "JsonObjectConverter.h"
 #include "LogHyperlinkEditor.h"
+#include "Misc/Compression.h"
+#include "Serialization/JsonSerializer.h"
+#include "Tasks/Task.h"
+#include "UObject/StructOnScope.h"
 #include "Windows/WindowsPlatformApplicationMisc.h"
 
 #define LOCTEXT_NAMESPACE "FHyperlinkEditorModule"
 
+/*
+ * State of the most recent link received by the local server, read by the status route. Only touched on the game
+ * thread
+ */
+namespace FHyperlinkLinkResponse
+{
+	enum class ELinkState : uint8
+	{
+		None,
+		Decoding,
+		Queued,
+		Failed
+	};
+	
+	static uint32 LastLinkId{ 0 };
+	static ELinkState LastLinkState{ ELinkState::None };
+	static FString LastErrorCode{};
+	static FString LastErrorMessage{};
+	
+	/* Built once when the server starts so responding to a link costs no more than a copy */
+	static TArray<uint8> PageBody{};
+	static TArray<uint8> CompressedPageBody{};
+	
+	/*
+	 * Polls the status route for the link's outcome. Once the link has executed it tries to close itself, which
+	 * browsers only allow for tabs opened by script, then falls back to the redirect the server used to respond with
+	 */
+	static const TCHAR* const PageHtml{ TEXT(R"(<!DOCTYPE html>
+<html><head><meta charset="utf-8"><title>Unreal Hyperlink</title></head>
+<body style="font-family:sans-serif;margin:2em"><p id="m">Opening in Unreal Editor...</p>
+<script>
+var m=document.getElementById("m");
+var s="/"+location.pathname.split("/")[1]+"/status";
+var n=0;
+function poll(){
+	fetch(s,{cache:"no-store"}).then(function(r){return r.json();}).then(function(j){
+		if(j.state==="executed"){m.textContent="Opened in Unreal Editor. You can close this tab.";window.close();
+			location.href="unrealhyperlink://open";}
+		else if(j.state==="failed"){m.textContent=j.errorMessage;}
+		else if(++n<50){setTimeout(poll,200);}
+	}).catch(function(){m.textContent="Lost connection to Unreal Editor.";});
+}
+poll();
+</script></body></html>
+)") };
+}
+
 FHyperlinkEditorCommands::FHyperlinkEditorCommands()
 	: TCommands<FHyperlinkEditorCommands>(
 			TEXT("HyperlinkEditor"),
@@ -31,13 +101,16 @@ void FHyperlinkEditorCommands::RegisterCommands()
 
 void FHyperlinkEditorModule::StartupModule()
 {
+	LLM_SCOPE_BYTAG(Hyperlink);
 	RegisterCustomisation();
 	RegisterPaste();
 	StartHttpServer();
+	StartIpcServer();
 }
 
 void FHyperlinkEditorModule::ShutdownModule()
 {
+	ShutdownIpcServer();
 	ShutdownHttpServer();
     UnregisterPaste();
 }
@@ -67,6 +140,23 @@ void FHyperlinkEditorModule::RegisterPaste()
 		TEXT("uhl.PasteLink"),
 		TEXT("Execute a link stored in the clipboard"),
 		FConsoleCommandDelegate::CreateStatic(&FHyperlinkEditorModule::PasteLink));
+
+	LinkFormatReportConsoleCommand = IConsoleManager::Get().RegisterConsoleCommand(
+		TEXT("uhl.LinkFormatReport"),
+		TEXT("Compare the length and encode/decode time of each link format for the built-in payload types"),
+		FConsoleCommandDelegate::CreateStatic(&FHyperlinkEditorModule::ReportLinkFormats));
+
+	BenchConsoleCommand = IConsoleManager::Get().RegisterConsoleCommand(
+		TEXT("uhl.Bench"),
+		TEXT("Benchmark the link pipeline and write the results to Saved/Hyperlink/bench.json. Usage: uhl.Bench "
+			"[Iterations]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&FHyperlinkEditorModule::BenchConsole));
+
+	LoadTestConsoleCommand = IConsoleManager::Get().RegisterConsoleCommand(
+		TEXT("uhl.LoadTest"),
+		TEXT("Send links to the local link server over loopback and report latency and frame time under load. Links "
+			"are not executed while it runs. Usage: uhl.LoadTest [RequestsPerSecond] [Concurrency] [DurationSeconds]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&FHyperlinkEditorModule::LoadTestConsole));
 }
 
 void FHyperlinkEditorModule::UnregisterPaste()
@@ -82,6 +172,15 @@ void FHyperlinkEditorModule::UnregisterPaste()
 
 	IConsoleManager::Get().UnregisterConsoleObject(PasteConsoleCommand);
 	PasteConsoleCommand = nullptr;
+	
+	IConsoleManager::Get().UnregisterConsoleObject(LinkFormatReportConsoleCommand);
+	LinkFormatReportConsoleCommand = nullptr;
+	
+	IConsoleManager::Get().UnregisterConsoleObject(BenchConsoleCommand);
+	BenchConsoleCommand = nullptr;
+	
+	IConsoleManager::Get().UnregisterConsoleObject(LoadTestConsoleCommand);
+	LoadTestConsoleCommand = nullptr;
 }
 
 /*static*/void FHyperlinkEditorModule::PasteLink()
@@ -91,8 +190,152 @@ void FHyperlinkEditorModule::UnregisterPaste()
 	ExecuteLinkFromString(ClipboardContents);
 }
 
+/*static*/void FHyperlinkEditorModule::ReportLinkFormats()
+{
+	struct FSample
+	{
+		const TCHAR* Name;
+		UClass* Class;
+		const UScriptStruct* Struct;
+		const void* Data;
+	};
+	
+	// Representative payload for each of the built-in payload types
+	const FName PackageName{ TEXT("/Game/Maps/ExampleMap") };
+	const FHyperlinkNamePayload NamePayload{ PackageName };
+	const FHyperlinkViewportPayload ViewportPayload{ PackageName, FVector(1024.5, -2048.25, 512.0),
+		FRotator(-15.0, 90.0, 0.0) };
+	const FHyperlinkBlueprintPayload BlueprintPayload{ TEXT("/Game/Blueprints/BP_Example"), FGuid::NewGuid(),
+		FGuid::NewGuid() };
+	const FHyperlinkMaterialPayload MaterialPayload{ TEXT("/Game/Materials/M_Example"), FGuid::NewGuid(), -1200, 350 };
+	const FHyperlinkLevelActorPayload LevelActorPayload{ PackageName, TEXT("StaticMeshActor_42") };
+	
+	const FSample Samples[]
+	{
+		{ TEXT("FHyperlinkNamePayload"), UHyperlinkEdit::StaticClass(), FHyperlinkNamePayload::StaticStruct(),
+			&NamePayload },
+		{ TEXT("FHyperlinkViewportPayload"), UHyperlinkViewport::StaticClass(),
+			FHyperlinkViewportPayload::StaticStruct(), &ViewportPayload },
+		{ TEXT("FHyperlinkBlueprintPayload"), UHyperlinkNode::StaticClass(),
+			FHyperlinkBlueprintPayload::StaticStruct(), &BlueprintPayload },
+		{ TEXT("FHyperlinkMaterialPayload"), UHyperlinkNode::StaticClass(), FHyperlinkMaterialPayload::StaticStruct(),
+			&MaterialPayload },
+		{ TEXT("FHyperlinkLevelActorPayload"), UHyperlinkLevelActor::StaticClass(),
+			FHyperlinkLevelActorPayload::StaticStruct(), &LevelActorPayload },
+	};
+	
+	static constexpr int32 Iterations{ 1000 };
+	const EHyperlinkLinkFormat Formats[]{ EHyperlinkLinkFormat::Json, EHyperlinkLinkFormat::Binary };
+	
+	FString Report{ FString::Printf(TEXT("%-28s %-8s %8s %12s %12s\n"),
+		TEXT("Payload"), TEXT("Format"), TEXT("Length"), TEXT("Encode (us)"), TEXT("Decode (us)")) };
+	FString CodecReport{ FString::Printf(TEXT("%-28s %-8s %12s %12s\n"),
+		TEXT("Payload"), TEXT("Path"), TEXT("Encode (us)"), TEXT("Decode (us)")) };
+	
+	for (const FSample& Sample : Samples)
+	{
+		FHyperlinkExecutePayload ExecutePayload{};
+		ExecutePayload.Class = Sample.Class;
+		ExecutePayload.DefinitionPayload.JsonObject = MakeShared<FJsonObject>();
+		FJsonObjectConverter::UStructToJsonObject(Sample.Struct, Sample.Data,
+			ExecutePayload.DefinitionPayload.JsonObject.ToSharedRef());
+		
+		for (const EHyperlinkLinkFormat Format : Formats)
+		{
+			FString Encoded{};
+			const double EncodeStart{ FPlatformTime::Seconds() };
+			for (int32 Idx{ 0 }; Idx < Iterations; ++Idx)
+			{
+				Encoded = FHyperlinkUtility::EscapeUrlString(
+					FHyperlinkFormat::SerializeExecutePayload(ExecutePayload, Format));
+			}
+			const double EncodeTime{ (FPlatformTime::Seconds() - EncodeStart) / Iterations };
+
+			bool bDecoded{ true };
+			const double DecodeStart{ FPlatformTime::Seconds() };
+			for (int32 Idx{ 0 }; Idx < Iterations; ++Idx)
+			{
+				FHyperlinkExecutePayload Decoded{};
+				bDecoded &= FHyperlinkFormat::TryDeserializeExecutePayload(
+					FHyperlinkUtility::ParseUrlString(Encoded), Decoded);
+			}
+			const double DecodeTime{ (FPlatformTime::Seconds() - DecodeStart) / Iterations };
+
+			UE_CLOG(!bDecoded, LogHyperlinkEditor, Error, TEXT("Failed to decode %s in format %s"), Sample.Name,
+				*StaticEnum<EHyperlinkLinkFormat>()->GetNameStringByValue(static_cast<int64>(Format)));
+			
+			Report.Appendf(TEXT("%-28s %-8s %8d %12.2f %12.2f\n"), Sample.Name,
+				*StaticEnum<EHyperlinkLinkFormat>()->GetNameStringByValue(static_cast<int64>(Format)),
+				Encoded.Len(), EncodeTime * 1.0e6, DecodeTime * 1.0e6);
+		}
+		
+		// Struct to JSON link and back, through FJsonObject (DOM) and through the payload codec (Typed)
+		for (const bool bTyped : { false, true })
+		{
+			FString Encoded{};
+			const double EncodeStart{ FPlatformTime::Seconds() };
+			for (int32 Idx{ 0 }; Idx < Iterations; ++Idx)
+			{
+				FHyperlinkExecutePayload StructPayload{};
+				StructPayload.Class = Sample.Class;
+				if (bTyped)
+				{
+					FHyperlinkPayloadCodec::WriteStruct(Sample.Struct, Sample.Data,
+						StructPayload.DefinitionPayload.JsonString);
+				}
+				else
+				{
+					StructPayload.DefinitionPayload.JsonObject = MakeShared<FJsonObject>();
+					FJsonObjectConverter::UStructToJsonObject(Sample.Struct, Sample.Data,
+						StructPayload.DefinitionPayload.JsonObject.ToSharedRef());
+				}
+				Encoded = FHyperlinkUtility::EscapeUrlString(
+					FHyperlinkFormat::SerializeExecutePayload(StructPayload, EHyperlinkLinkFormat::Json));
+			}
+			const double EncodeTime{ (FPlatformTime::Seconds() - EncodeStart) / Iterations };
+			
+			bool bDecoded{ true };
+			FStructOnScope DecodedStruct{ Sample.Struct };
+			const double DecodeStart{ FPlatformTime::Seconds() };
+			for (int32 Idx{ 0 }; Idx < Iterations; ++Idx)
+			{
+				FHyperlinkExecutePayload Decoded{};
+				bDecoded &= FHyperlinkFormat::TryDeserializeExecutePayload(
+					FHyperlinkUtility::ParseUrlString(Encoded), Decoded);
+				if (bTyped)
+				{
+					bDecoded &= FHyperlinkPayloadCodec::ReadStruct(Decoded.DefinitionPayload.JsonString,
+						Sample.Struct, DecodedStruct.GetStructMemory());
+				}
+				else
+				{
+					TSharedPtr<FJsonObject> JsonObject{};
+					bDecoded &= FJsonSerializer::Deserialize(
+						TJsonReaderFactory<>::Create(Decoded.DefinitionPayload.JsonString), JsonObject)
+						&& FJsonObjectConverter::JsonObjectToUStruct(JsonObject.ToSharedRef(), Sample.Struct,
+							DecodedStruct.GetStructMemory());
+				}
+			}
+			const double DecodeTime{ (FPlatformTime::Seconds() - DecodeStart) / Iterations };
+			
+			const TCHAR* const Path{ bTyped ? TEXT("Typed") : TEXT("DOM") };
+			UE_CLOG(!bDecoded, LogHyperlinkEditor, Error, TEXT("Failed to decode %s using %s path"), Sample.Name, Path);
+			
+			CodecReport.Appendf(TEXT("%-28s %-8s %12.2f %12.2f\n"), Sample.Name, Path, EncodeTime * 1.0e6,
+				DecodeTime * 1.0e6);
+		}
+	}
+
+	UE_LOG(LogHyperlinkEditor, Display, TEXT("Link format report (payload only, excluding \"%s\"):\n%s"),
+		*FHyperlinkUtility::GetLinkBaseAddress(), *Report);
+	UE_LOG(LogHyperlinkEditor, Display, TEXT("Payload codec report (struct to JSON link and back):\n%s"),
+		*CodecReport);
+}
+
 void FHyperlinkEditorModule::StartHttpServer()
 {
+	const FHyperlinkStartupProfiler::FScope ProfilerScope{ TEXT("FHyperlinkEditorModule::StartHttpServer") };
+	
 	if (!HttpRouter.IsValid())
 	{
 		// TODO: we need to restart the server if the user changes this port
@@ -101,10 +344,26 @@ void FHyperlinkEditorModule::StartHttpServer()
 		if (HttpRouter.IsValid())
 		{
 			// Use route for versioning
+			const FString ProjectPath{ FString::Printf(TEXT("/%s"),
+				*GetDefault<UHyperlinkSettings>()->GetProjectIdentifier()) };
 			HttpRequestHandle = HttpRouter->BindRoute(
-				FHttpPath(FString::Printf(TEXT("/%s"), *GetDefault<UHyperlinkSettings>()->GetProjectIdentifier())),
+				FHttpPath(ProjectPath),
 				EHttpServerRequestVerbs::VERB_GET,
 				HandleHttpRequest);
+			// More specific routes are matched first, so these take precedence over links
+			MetricsRequestHandle = HttpRouter->BindRoute(
+				FHttpPath(ProjectPath / TEXT("metrics")),
+				EHttpServerRequestVerbs::VERB_GET,
+				HandleMetricsRequest);
+			HealthRequestHandle = HttpRouter->BindRoute(
+				FHttpPath(ProjectPath / TEXT("health")),
+				EHttpServerRequestVerbs::VERB_GET,
+				HandleHealthRequest);
+			StatusRequestHandle = HttpRouter->BindRoute(
+				FHttpPath(ProjectPath / TEXT("status")),
+				EHttpServerRequestVerbs::VERB_GET,
+				HandleStatusRequest);
+			BuildLinkResponsePage();
 
 			FHttpServerModule::Get().StartAllListeners();
 		}
@@ -121,37 +380,360 @@ void FHyperlinkEditorModule::ShutdownHttpServer()
 	if (HttpRouter.IsValid())
 	{
 		HttpRouter->UnbindRoute(HttpRequestHandle);
+		HttpRouter->UnbindRoute(MetricsRequestHandle);
+		HttpRouter->UnbindRoute(HealthRequestHandle);
+		HttpRouter->UnbindRoute(StatusRequestHandle);
 	}
 
 	HttpRequestHandle.Reset();
+	MetricsRequestHandle.Reset();
+	HealthRequestHandle.Reset();
+	StatusRequestHandle.Reset();
 	HttpRouter.Reset();
 }
 
+void FHyperlinkEditorModule::StartIpcServer()
+{
+	const FHyperlinkStartupProfiler::FScope ProfilerScope{ TEXT("FHyperlinkEditorModule::StartIpcServer") };
+	
+	if (!IpcServer.IsValid())
+	{
+		IpcServer = MakeUnique<FHyperlinkIpcServer>();
+		if (!IpcServer->Start())
+		{
+			IpcServer.Reset();
+		}
+	}
+}
+
+void FHyperlinkEditorModule::ShutdownIpcServer()
+{
+	// Stops the server thread
+	IpcServer.Reset();
+}
+
 bool FHyperlinkEditorModule::HandleHttpRequest(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
 {
-	const FString& PathString = Request.RelativePath.GetPath();
-	ExecuteLinkFromString(PathString);
+	LLM_SCOPE_BYTAG(Hyperlink);
+	UHyperlinkSubsystem* const HyperlinkSubsystem{ GEngine->GetEngineSubsystem<UHyperlinkSubsystem>() };
+	if (HyperlinkSubsystem == nullptr)
+	{
+		UE_LOG(LogHyperlinkEditor, Error, TEXT("Could not execute link, could not find Hyperlink Subsystem!"));
+		OnComplete(FHttpServerResponse::Error(EHttpServerResponseCodes::ServiceUnavail,
+			TEXT("errors.com.hyperlink.unavailable"), TEXT("The Hyperlink subsystem is not available.")));
+	}
+	else
+	{
+		HyperlinkSubsystem->BeginReceiveLink();
+		const uint32 LinkId{ ++FHyperlinkLinkResponse::LastLinkId };
+		FHyperlinkLinkResponse::LastLinkState = FHyperlinkLinkResponse::ELinkState::Decoding;
+		
+		// Respond to browsers before doing any work so they never wait on the editor, however heavy the link is. The
+		// page asks the status route how the link went. Other clients, e.g. scripts, wait for a status code instead
+		const bool bRespondFirst{ HasHeaderValue(Request, TEXT("Accept"), TEXT("text/html")) };
+		if (bRespondFirst)
+		{
+			OnComplete(CreateLinkResponse(Request));
+		}
+		
+		// Decoding and validating the link doesn't touch any UObjects so is done on a worker thread, leaving only the
+		// execution itself on the game thread
+		UE::Tasks::Launch(UE_SOURCE_LOCATION,
+			[PathString = Request.RelativePath.GetPath(), Snapshot = HyperlinkSubsystem->GetDefinitionSnapshot(),
+			LinkStore = HyperlinkSubsystem->GetSharedLinkStore(),
+			WeakSubsystem = TWeakObjectPtr<UHyperlinkSubsystem>(HyperlinkSubsystem), LinkId,
+			OnComplete = bRespondFirst ? FHttpResultCallback{} : OnComplete]()
+			{
+				FHyperlinkExecutePayload Payload{};
+				const EHyperlinkDecodeResult DecodeResult
+					{ UHyperlinkSubsystem::DecodeLink(PathString, *Snapshot, LinkStore.Get(), Payload) };
+
+				AsyncTask(ENamedThreads::GameThread,
+					[DecodeResult, Payload = MoveTemp(Payload), WeakSubsystem, LinkId, OnComplete]()
+					{
+						using namespace FHyperlinkLinkResponse;
+						
+						// Load tests send links as a dry run, which would skew the counts of real links
+						if (WeakSubsystem.IsValid() && !WeakSubsystem->IsDryRun())
+						{
+							FHyperlinkMetrics::RecordDecode(DecodeResult);
+						}
+						const EHyperlinkQueueResult QueueResult
+							{ DecodeResult == EHyperlinkDecodeResult::Success && WeakSubsystem.IsValid()
+								? WeakSubsystem->QueueLink(Payload) : EHyperlinkQueueResult::Dropped };
+						const bool bQueued{ QueueResult != EHyperlinkQueueResult::Dropped };
+						if (WeakSubsystem.IsValid())
+						{
+							WeakSubsystem->EndReceiveLink();
+						}
+						
+						FString ErrorCode{};
+						FString ErrorMessage{};
+						const EHttpServerResponseCodes ResponseCode
+							{ GetLinkError(DecodeResult, bQueued, ErrorCode, ErrorMessage) };
+						if (OnComplete && QueueResult == EHyperlinkQueueResult::Coalesced)
+						{
+							// Distinct from 200 so clients can tell the link was merged with an identical one
+							TUniquePtr<FHttpServerResponse> Response{ MakeUnique<FHttpServerResponse>() };
+							Response->Code = EHttpServerResponseCodes::NoContent;
+							OnComplete(MoveTemp(Response));
+						}
+						else if (OnComplete)
+						{
+							OnComplete(bQueued ? FHttpServerResponse::Ok()
+								: FHttpServerResponse::Error(ResponseCode, ErrorCode, ErrorMessage));
+						}
+						
+						// Only the most recent link is reported
+						if (LinkId == LastLinkId)
+						{
+							LastLinkState = bQueued ? ELinkState::Queued : ELinkState::Failed;
+							LastErrorCode = MoveTemp(ErrorCode);
+							LastErrorMessage = MoveTemp(ErrorMessage);
+						}
+					});
+			});
+	}
+
+	return true; // true = request handled
+}
+
+/*static*/EHttpServerResponseCodes FHyperlinkEditorModule::GetLinkError(const EHyperlinkDecodeResult DecodeResult,
+	const bool bQueued, FString& OutErrorCode, FString& OutErrorMessage)
+{
+	EHttpServerResponseCodes Ret{ EHttpServerResponseCodes::Ok };
+	switch (DecodeResult)
+	{
+	case EHyperlinkDecodeResult::Success:
+		if (!bQueued)
+		{
+			Ret = EHttpServerResponseCodes::ServiceUnavail;
+			OutErrorCode = TEXT("errors.com.hyperlink.busy");
+			OutErrorMessage = TEXT("The editor is busy executing other links. Try again shortly.");
+		}
+		break;
+	case EHyperlinkDecodeResult::Malformed:
+		Ret = EHttpServerResponseCodes::BadRequest;
+		OutErrorCode = TEXT("errors.com.hyperlink.malformed");
+		OutErrorMessage = TEXT("The link is not a valid Hyperlink link.");
+		break;
+	case EHyperlinkDecodeResult::NotStored:
+		Ret = EHttpServerResponseCodes::NotFound;
+		OutErrorCode = TEXT("errors.com.hyperlink.not_found");
+		OutErrorMessage = TEXT("The link payload was not found in the link store. It may have expired or not been "
+			"synced yet.");
+		break;
+	case EHyperlinkDecodeResult::UnknownDefinition:
+		Ret = EHttpServerResponseCodes::NotFound;
+		OutErrorCode = TEXT("errors.com.hyperlink.unknown_definition");
+		OutErrorMessage = TEXT("The link type is not registered in this project. It may be disabled in the Hyperlink "
+			"settings.");
+		break;
+	case EHyperlinkDecodeResult::MissingAsset:
+		Ret = EHttpServerResponseCodes::NotFound;
+		OutErrorCode = TEXT("errors.com.hyperlink.missing_asset");
+		OutErrorMessage = TEXT("An asset the link refers to does not exist in this project.");
+		break;
+	default:
+		checkNoEntry();
+		break;
+	}
+	return Ret;
+}
+
+/*static*/bool FHyperlinkEditorModule::HasHeaderValue(const FHttpServerRequest& Request, const TCHAR* const Header,
+	const TCHAR* const Value)
+{
+	const TArray<FString>* const Values{ Request.Headers.Find(Header) };
+	return Values && Values->ContainsByPredicate([Value](const FString& HeaderValue)
+	{
+		return HeaderValue.Contains(Value);
+	});
+}
+
+/*static*/void FHyperlinkEditorModule::BuildLinkResponsePage()
+{
+	using namespace FHyperlinkLinkResponse;
+	
+	const FTCHARToUTF8 PageUtf8{ PageHtml };
+	PageBody = TArray<uint8>(reinterpret_cast<const uint8*>(PageUtf8.Get()), PageUtf8.Length());
+	
+	int32 CompressedSize{ FCompression::CompressMemoryBound(NAME_Gzip, PageBody.Num()) };
+	CompressedPageBody.SetNumUninitialized(CompressedSize);
+	if (FCompression::CompressMemory(NAME_Gzip, CompressedPageBody.GetData(), CompressedSize, PageBody.GetData(),
+		PageBody.Num()))
+	{
+		CompressedPageBody.SetNum(CompressedSize);
+	}
+	else
+	{
+		CompressedPageBody.Reset();
+	}
+}
+
+/*static*/TUniquePtr<FHttpServerResponse> FHyperlinkEditorModule::CreateLinkResponse(const FHttpServerRequest& Request)
+{
+	using namespace FHyperlinkLinkResponse;
+	
+	const bool bCompressed
+		{ CompressedPageBody.Num() > 0 && HasHeaderValue(Request, TEXT("Accept-Encoding"), TEXT("gzip")) };
+	
+	TUniquePtr<FHttpServerResponse> Response{ FHttpServerResponse::Create(
+		TArray<uint8>(bCompressed ? CompressedPageBody : PageBody), TEXT("text/html; charset=utf-8")) };
+	if (bCompressed)
+	{
+		Response->Headers.Add(TEXT("Content-Encoding"), { TEXT("gzip") });
+	}
+	// Every visit to a link has to reach the editor to execute it, so the page must never be cached
+	Response->Headers.Add(TEXT("Cache-Control"), { TEXT("no-store") });
+	Response->Headers.Add(TEXT("Vary"), { TEXT("Accept-Encoding") });
+	return Response;
+}
 
-	// Redirect to the local URL scheme as a workaround to close the opened tab (this only works on chrome but it's
-	// better than nothing
-	TUniquePtr<FHttpServerResponse> Response{ MakeUnique<FHttpServerResponse>() };
-	Response->Headers.Add(TEXT("Location"), { TEXT("unrealhyperlink://open") });
-	Response->Code = EHttpServerResponseCodes::Moved;
+/*static*/bool FHyperlinkEditorModule::HandleStatusRequest(const FHttpServerRequest& Request,
+	const FHttpResultCallback& OnComplete)
+{
+	using namespace FHyperlinkLinkResponse;
+	
+	const UHyperlinkSubsystem* const HyperlinkSubsystem{ GEngine->GetEngineSubsystem<UHyperlinkSubsystem>() };
+	const TCHAR* State{ TEXT("none") };
+	switch (LastLinkState)
+	{
+	case ELinkState::None:
+		break;
+	case ELinkState::Decoding:
+		State = TEXT("decoding");
+		break;
+	case ELinkState::Queued:
+		// The link and any loading it started have finished once the subsystem stops receiving
+		State = HyperlinkSubsystem && HyperlinkSubsystem->IsReceivingLink() ? TEXT("queued") : TEXT("executed");
+		break;
+	case ELinkState::Failed:
+		State = TEXT("failed");
+		break;
+	default:
+		checkNoEntry();
+		break;
+	}
 	
+	FString JsonString{};
+	const TSharedRef<TJsonWriter<>> JsonWriter{ TJsonWriterFactory<>::Create(&JsonString) };
+	JsonWriter->WriteObjectStart();
+	JsonWriter->WriteValue(TEXT("id"), static_cast<int64>(LastLinkId));
+	JsonWriter->WriteValue(TEXT("state"), State);
+	if (LastLinkState == ELinkState::Failed)
+	{
+		JsonWriter->WriteValue(TEXT("errorCode"), LastErrorCode);
+		JsonWriter->WriteValue(TEXT("errorMessage"), LastErrorMessage);
+	}
+	JsonWriter->WriteObjectEnd();
+	JsonWriter->Close();
+	
+	TUniquePtr<FHttpServerResponse> Response{ FHttpServerResponse::Create(JsonString, TEXT("application/json")) };
+	Response->Headers.Add(TEXT("Cache-Control"), { TEXT("no-store") });
 	OnComplete(MoveTemp(Response));
-	return true; // true = request handled
+	return true;
 }
 
-/*static*/void FHyperlinkEditorModule::ExecuteLinkFromString(const FString& InString)
+/*static*/void FHyperlinkEditorModule::BenchConsole(const TArray<FString>& Args)
 {
+	static constexpr int32 DefaultIterations{ 1000 };
+	int32 Iterations{ DefaultIterations };
+	if (Args.Num() > 0 && (!LexTryParseString(Iterations, *Args[0]) || Iterations < 1))
+	{
+		UE_LOG(LogHyperlinkEditor, Warning, TEXT("Invalid iteration count %s, using %d"), *Args[0], DefaultIterations);
+		Iterations = DefaultIterations;
+	}
+	FHyperlinkBenchmark::Run(Iterations);
+}
+
+/*static*/void FHyperlinkEditorModule::LoadTestConsole(const TArray<FString>& Args)
+{
+	FHyperlinkLoadTest::FSettings Settings{};
+	bool bValid{ true };
+	if (Args.Num() > 0)
+	{
+		bValid &= LexTryParseString(Settings.RequestsPerSecond, *Args[0]) && Settings.RequestsPerSecond > 0.0;
+	}
+	if (Args.Num() > 1)
+	{
+		bValid &= LexTryParseString(Settings.Concurrency, *Args[1]) && Settings.Concurrency > 0;
+	}
+	if (Args.Num() > 2)
+	{
+		bValid &= LexTryParseString(Settings.DurationSeconds, *Args[2]) && Settings.DurationSeconds > 0.0;
+	}
+	
+	if (bValid)
+	{
+		FHyperlinkLoadTest::Start(Settings);
+	}
+	else
+	{
+		UE_LOG(LogHyperlinkEditor, Display, TEXT("Invalid arguments, usage: uhl.LoadTest [RequestsPerSecond] "
+			"[Concurrency] [DurationSeconds]"));
+	}
+}
+
+/*static*/bool FHyperlinkEditorModule::HandleMetricsRequest(const FHttpServerRequest& Request,
+	const FHttpResultCallback& OnComplete)
+{
+	OnComplete(FHttpServerResponse::Create(FHyperlinkMetrics::ExportPrometheus(),
+		TEXT("text/plain; version=0.0.4; charset=utf-8")));
+	return true;
+}
+
+/*static*/bool FHyperlinkEditorModule::HandleHealthRequest(const FHttpServerRequest& Request,
+	const FHttpResultCallback& OnComplete)
+{
+	const UHyperlinkSubsystem* const HyperlinkSubsystem{ GEngine->GetEngineSubsystem<UHyperlinkSubsystem>() };
+	const bool bDefinitionsInitialized{ HyperlinkSubsystem && HyperlinkSubsystem->AreDefinitionsInitialized() };
+	const int32 NumQueuedLinks{ HyperlinkSubsystem ? HyperlinkSubsystem->GetNumQueuedLinks() : 0 };
+	
+	// Busy editors will be slow to execute links: a slow task or modal dialog blocks them until it's dismissed
+	const bool bPlaying{ GEditor && GEditor->IsPlaySessionInProgress() };
+	const bool bModal
+		{ FSlateApplication::IsInitialized() && FSlateApplication::Get().GetActiveModalWindow().IsValid() };
+	const bool bIdle{ !GIsSlowTask && !bModal && !bPlaying && !IsAsyncLoading() && NumQueuedLinks == 0 };
+
+	FString JsonString{};
+	const TSharedRef<TJsonWriter<>> JsonWriter{ TJsonWriterFactory<>::Create(&JsonString) };
+	JsonWriter->WriteObjectStart();
+	JsonWriter->WriteValue(TEXT("status"), bDefinitionsInitialized ? TEXT("ok") : TEXT("starting"));
+	JsonWriter->WriteValue(TEXT("definitionsInitialized"), bDefinitionsInitialized);
+	JsonWriter->WriteValue(TEXT("numDefinitions"),
+		HyperlinkSubsystem ? HyperlinkSubsystem->GetDefinitionSnapshot()->Num() : 0);
+	JsonWriter->WriteValue(TEXT("numDeferredDefinitions"),
+		HyperlinkSubsystem ? HyperlinkSubsystem->GetNumDeferredDefinitions() : 0);
+	JsonWriter->WriteValue(TEXT("editorIdle"), bIdle);
+	JsonWriter->WriteValue(TEXT("playing"), bPlaying);
+	JsonWriter->WriteValue(TEXT("modal"), bModal);
+	JsonWriter->WriteValue(TEXT("slowTask"), GIsSlowTask);
+	JsonWriter->WriteValue(TEXT("asyncLoading"), IsAsyncLoading());
+	JsonWriter->WriteValue(TEXT("queuedLinks"), NumQueuedLinks);
+	JsonWriter->WriteObjectEnd();
+	JsonWriter->Close();
+
+	TUniquePtr<FHttpServerResponse> Response{ FHttpServerResponse::Create(JsonString, TEXT("application/json")) };
+	Response->Code = bDefinitionsInitialized ? EHttpServerResponseCodes::Ok : EHttpServerResponseCodes::ServiceUnavail;
+	OnComplete(MoveTemp(Response));
+	return true;
+}
+
+/*static*/bool FHyperlinkEditorModule::ExecuteLinkFromString(const FString& InString)
+{
+	bool bResult{ false };
+	
 	if (UHyperlinkSubsystem* const HyperlinkSubsystem{ GEngine->GetEngineSubsystem<UHyperlinkSubsystem>() })
 	{
-		HyperlinkSubsystem->ExecuteLink(InString);
+		bResult = HyperlinkSubsystem->ExecuteLink(InString);
 	}
 	else
 	{
 		UE_LOG(LogHyperlinkEditor, Error, TEXT("Could not execute link, could not find Hyperlink Subsystem!"));
 	}
+
+	return bResult;
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -0,0 +1,661 @@
+﻿// Copyright (c) 2023-2024 Fergus Brown. Licensed under the MIT license. See "LICENSE" file for details.
+
+
+#include "HyperlinkIpcServer.h"
+
+#include "Async/Async.h"
+#include "Async/Future.h"
+#include "Containers/Ticker.h"
+#include "Engine/Engine.h"
+#include "HAL/FileManager.h"
+#include "HAL/RunnableThread.h"
+#include "HyperlinkExecutePayload.h"
+#include "HyperlinkMetrics.h"
+#include "HyperlinkSettings.h"
+#include "HyperlinkStats.h"
+#include "HyperlinkSubsystem.h"
+#include "LogHyperlinkEditor.h"
+#include "Misc/ByteSwap.h"
+#include "Misc/Paths.h"
+#include "Tasks/Task.h"
+
+#if PLATFORM_WINDOWS
+#include "Windows/WindowsHWrapper.h"
+#elif PLATFORM_UNIX || PLATFORM_MAC
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+namespace FHyperlinkIpcServerConstants
+{
+	/* Longer frames are treated as a protocol error and the client is disconnected */
+	static constexpr uint32 MaxLinkBytes{ 64 * 1024 };
+	static constexpr int32 MaxBatchLinks{ 64 * 1024 };
+	/* How often a batch waiting on the game thread checks whether the server is stopping */
+	static constexpr double BatchPollSeconds{ 0.1 };
+}
+
+namespace FHyperlinkIpcServerHelpers
+{
+	/* Mapped explicitly so reordering EHyperlinkDecodeResult can't change the wire protocol */
+	static EHyperlinkIpcStatus GetIpcStatus(const EHyperlinkDecodeResult DecodeResult)
+	{
+		EHyperlinkIpcStatus Ret{ EHyperlinkIpcStatus::Malformed };
+		switch (DecodeResult)
+		{
+		case EHyperlinkDecodeResult::Success:
+			Ret = EHyperlinkIpcStatus::Queued;
+			break;
+		case EHyperlinkDecodeResult::Malformed:
+			Ret = EHyperlinkIpcStatus::Malformed;
+			break;
+		case EHyperlinkDecodeResult::NotStored:
+			Ret = EHyperlinkIpcStatus::NotStored;
+			break;
+		case EHyperlinkDecodeResult::UnknownDefinition:
+			Ret = EHyperlinkIpcStatus::UnknownDefinition;
+			break;
+		case EHyperlinkDecodeResult::MissingAsset:
+			Ret = EHyperlinkIpcStatus::MissingAsset;
+			break;
+		default:
+			checkNoEntry();
+			break;
+		}
+		return Ret;
+	}
+	
+	static EHyperlinkIpcStatus GetIpcStatus(const EHyperlinkQueueResult QueueResult)
+	{
+		EHyperlinkIpcStatus Ret{ EHyperlinkIpcStatus::Dropped };
+		switch (QueueResult)
+		{
+		case EHyperlinkQueueResult::Queued:
+			Ret = EHyperlinkIpcStatus::Queued;
+			break;
+		case EHyperlinkQueueResult::Coalesced:
+			Ret = EHyperlinkIpcStatus::Coalesced;
+			break;
+		case EHyperlinkQueueResult::Dropped:
+			Ret = EHyperlinkIpcStatus::Dropped;
+			break;
+		default:
+			checkNoEntry();
+			break;
+		}
+		return Ret;
+	}
+}
+
+/* Links of a batch which have been decoded, queued over as many frames as it takes the inbox to make space for them */
+struct FHyperlinkIpcBatch
+{
+	TArray<FHyperlinkExecutePayload> Payloads{};
+	TArray<uint8> Statuses{};
+	int32 NextIdx{ 0 };
+	TWeakObjectPtr<UHyperlinkSubsystem> WeakSubsystem{ nullptr };
+	TSharedPtr<TPromise<TArray<uint8>>, ESPMode::ThreadSafe> Promise{ nullptr };
+
+	/**
+	 * @brief Queue links until the inbox is full, call on the game thread
+	 * @return true once every link has been queued or rejected and the promise has been set
+	 */
+	bool QueueLinks()
+	{
+		bool bBlocked{ false };
+		while (NextIdx < Payloads.Num() && !bBlocked)
+		{
+			if (Statuses[NextIdx] != static_cast<uint8>(EHyperlinkIpcStatus::Queued))
+			{
+				// Decode failed, the status is already its reason
+			}
+			else if (!WeakSubsystem.IsValid())
+			{
+				Statuses[NextIdx] = static_cast<uint8>(EHyperlinkIpcStatus::Unavailable);
+			}
+			else if (WeakSubsystem->GetLinkInboxSpace() == 0)
+			{
+				// Wait for the inbox to drain instead of dropping the rest of the batch
+				bBlocked = true;
+			}
+			else
+			{
+				Statuses[NextIdx] = static_cast<uint8>(FHyperlinkIpcServerHelpers::GetIpcStatus(
+					WeakSubsystem->QueueLink(Payloads[NextIdx])));
+			}
+			NextIdx += bBlocked ? 0 : 1;
+		}
+
+		if (!bBlocked)
+		{
+			if (WeakSubsystem.IsValid())
+			{
+				WeakSubsystem->EndReceiveLink();
+			}
+			Promise->SetValue(MoveTemp(Statuses));
+		}
+		return !bBlocked;
+	}
+};
+
+#if PLATFORM_WINDOWS
+struct FHyperlinkIpcServer::FPlatformState
+{
+	HANDLE Pipe{ INVALID_HANDLE_VALUE };
+	/* Signalled when an overlapped operation on the pipe completes */
+	HANDLE IoEvent{ nullptr };
+	/* Signalled by Stop to cancel the operation in progress */
+	HANDLE StopEvent{ nullptr };
+
+	OVERLAPPED MakeOverlapped() const
+	{
+		OVERLAPPED Overlapped{};
+		Overlapped.hEvent = IoEvent;
+		ResetEvent(IoEvent);
+		return Overlapped;
+	}
+
+	/**
+	 * @brief Wait for an overlapped operation to finish
+	 * @param bCompleted What the call which started the operation returned
+	 * @return false if the operation failed or the server is stopping
+	 */
+	bool Wait(OVERLAPPED& Overlapped, const bool bCompleted, DWORD& OutNumBytes) const
+	{
+		bool bResult{ false };
+		if (bCompleted || GetLastError() == ERROR_IO_PENDING)
+		{
+			const HANDLE Handles[]{ IoEvent, StopEvent };
+			if (bCompleted
+				|| WaitForMultipleObjects(UE_ARRAY_COUNT(Handles), Handles, FALSE, INFINITE) == WAIT_OBJECT_0)
+			{
+				bResult = GetOverlappedResult(Pipe, &Overlapped, &OutNumBytes, FALSE) != FALSE;
+			}
+			else
+			{
+				// The operation has to finish before Overlapped goes out of scope
+				CancelIo(Pipe);
+				GetOverlappedResult(Pipe, &Overlapped, &OutNumBytes, TRUE);
+			}
+		}
+		return bResult;
+	}
+};
+#elif PLATFORM_UNIX || PLATFORM_MAC
+struct FHyperlinkIpcServer::FPlatformState
+{
+	int ListenSocket{ -1 };
+	int ClientSocket{ -1 };
+	/* Stop writes to the second descriptor to wake the server thread */
+	int StopPipe[2]{ -1, -1 };
+
+	/* Wait until Socket is ready for Events. @return false if the server is stopping */
+	bool Wait(const int Socket, const short Events) const
+	{
+		pollfd Fds[]{ { Socket, Events, 0 }, { StopPipe[0], POLLIN, 0 } };
+		int NumReady{ 0 };
+		do
+		{
+			NumReady = poll(Fds, UE_ARRAY_COUNT(Fds), -1);
+		}
+		while (NumReady < 0 && errno == EINTR);
+		return NumReady > 0 && Fds[1].revents == 0;
+	}
+};
+#else
+struct FHyperlinkIpcServer::FPlatformState
+{
+};
+#endif
+
+FHyperlinkIpcServer::FHyperlinkIpcServer()
+	: Platform{ MakeUnique<FPlatformState>() }
+{
+}
+
+FHyperlinkIpcServer::~FHyperlinkIpcServer()
+{
+	if (Thread)
+	{
+		// Calls Stop and waits for Run to return
+		Thread->Kill(true);
+		delete Thread;
+		Thread = nullptr;
+	}
+	Close();
+}
+
+bool FHyperlinkIpcServer::Start()
+{
+	EndpointName = GetEndpointName();
+	bool bResult{ Listen() };
+	if (bResult)
+	{
+		Thread = FRunnableThread::Create(this, TEXT("HyperlinkIpcServer"));
+		bResult = Thread != nullptr;
+	}
+
+	if (bResult)
+	{
+		UE_LOG(LogHyperlinkEditor, Display, TEXT("Hyperlink IPC server listening on %s"), *EndpointName);
+	}
+	else
+	{
+		Close();
+	}
+	return bResult;
+}
+
+/*static*/FString FHyperlinkIpcServer::GetEndpointName()
+{
+#if PLATFORM_WINDOWS
+	// Named pipes live in their own namespace rather than the file system
+	return FString::Printf(TEXT("\\\\.\\pipe\\UnrealHyperlink-%s"),
+		*GetDefault<UHyperlinkSettings>()->GetProjectIdentifier());
+#else
+	return FPaths::ConvertRelativePathToFull(FPaths::ProjectSavedDir() / TEXT("Hyperlink") / TEXT("links.sock"));
+#endif //PLATFORM_WINDOWS
+}
+
+uint32 FHyperlinkIpcServer::Run()
+{
+	while (Accept())
+	{
+		ServeClient();
+		Disconnect();
+	}
+	return 0;
+}
+
+void FHyperlinkIpcServer::Stop()
+{
+	bStopping.store(true, std::memory_order_relaxed);
+#if PLATFORM_WINDOWS
+	SetEvent(Platform->StopEvent);
+#elif PLATFORM_UNIX || PLATFORM_MAC
+	const uint8 Wake{ 0 };
+	// NOLINTNEXTLINE(bugprone-unused-return-value) : the pipe only has to become readable, one byte is enough
+	write(Platform->StopPipe[1], &Wake, sizeof(Wake));
+#endif
+}
+
+void FHyperlinkIpcServer::ServeClient()
+{
+	using namespace FHyperlinkIpcServerConstants;
+	LLM_SCOPE_BYTAG(Hyperlink);
+
+	TArray<FString> Links{};
+	TArray<uint8> Buffer{};
+	bool bConnected{ true };
+	while (bConnected)
+	{
+		uint32 NumBytes{ 0 };
+		bConnected = Read(&NumBytes, sizeof(NumBytes));
+		NumBytes = INTEL_ORDER32(NumBytes);
+		if (!bConnected)
+		{
+			// Client disconnected, any links of an unfinished batch are discarded
+		}
+		else if (NumBytes == 0)
+		{
+			const TArray<uint8> Statuses{ ExecuteBatch(MoveTemp(Links)) };
+			Links.Reset();
+			bConnected = !bStopping.load(std::memory_order_relaxed) && Write(Statuses.GetData(), Statuses.Num());
+		}
+		else if (NumBytes > MaxLinkBytes || Links.Num() >= MaxBatchLinks)
+		{
+			UE_LOG(LogHyperlinkEditor, Warning, TEXT("Disconnecting Hyperlink IPC client: links must be at most %u "
+				"bytes and batches at most %d links"), MaxLinkBytes, MaxBatchLinks);
+			bConnected = false;
+		}
+		else
+		{
+			Buffer.SetNumUninitialized(NumBytes);
+			bConnected = Read(Buffer.GetData(), NumBytes);
+			if (bConnected)
+			{
+				const FUTF8ToTCHAR Link{ reinterpret_cast<const ANSICHAR*>(Buffer.GetData()),
+					static_cast<int32>(NumBytes) };
+				Links.Emplace(Link.Length(), Link.Get());
+			}
+		}
+	}
+}
+
+TArray<uint8> FHyperlinkIpcServer::ExecuteBatch(TArray<FString> Links) const
+{
+	using namespace FHyperlinkIpcServerConstants;
+
+	const TSharedRef<TPromise<TArray<uint8>>, ESPMode::ThreadSafe> Promise
+		{ MakeShared<TPromise<TArray<uint8>>, ESPMode::ThreadSafe>() };
+	const TFuture<TArray<uint8>> Future{ Promise->GetFuture() };
+
+	// Same path as links received over HTTP: the snapshot is taken on the game thread, the links are decoded on a
+	// worker and queued back on the game thread
+	AsyncTask(ENamedThreads::GameThread, [Links = MoveTemp(Links), Promise]() mutable
+	{
+		LLM_SCOPE_BYTAG(Hyperlink);
+		UHyperlinkSubsystem* const HyperlinkSubsystem
+			{ GEngine ? GEngine->GetEngineSubsystem<UHyperlinkSubsystem>() : nullptr };
+		if (HyperlinkSubsystem == nullptr)
+		{
+			TArray<uint8> Statuses{};
+			Statuses.Init(static_cast<uint8>(EHyperlinkIpcStatus::Unavailable), Links.Num());
+			Promise->SetValue(MoveTemp(Statuses));
+		}
+		else
+		{
+			HyperlinkSubsystem->BeginReceiveLink();
+			UE::Tasks::Launch(UE_SOURCE_LOCATION,
+				[Links = MoveTemp(Links), Snapshot = HyperlinkSubsystem->GetDefinitionSnapshot(),
+				LinkStore = HyperlinkSubsystem->GetSharedLinkStore(),
+				WeakSubsystem = TWeakObjectPtr<UHyperlinkSubsystem>(HyperlinkSubsystem), Promise]()
+				{
+					const TSharedRef<FHyperlinkIpcBatch, ESPMode::ThreadSafe> Batch
+						{ MakeShared<FHyperlinkIpcBatch, ESPMode::ThreadSafe>() };
+					Batch->Payloads.SetNum(Links.Num());
+					Batch->Statuses.SetNumUninitialized(Links.Num());
+					Batch->WeakSubsystem = WeakSubsystem;
+					Batch->Promise = Promise;
+					for (int32 Idx{ 0 }; Idx < Links.Num(); ++Idx)
+					{
+						const EHyperlinkDecodeResult DecodeResult{ UHyperlinkSubsystem::DecodeLink(Links[Idx],
+							*Snapshot, LinkStore.Get(), Batch->Payloads[Idx]) };
+						FHyperlinkMetrics::RecordDecode(DecodeResult);
+						Batch->Statuses[Idx] =
+							static_cast<uint8>(FHyperlinkIpcServerHelpers::GetIpcStatus(DecodeResult));
+					}
+
+					AsyncTask(ENamedThreads::GameThread, [Batch]()
+					{
+						// Batches can be larger than the inbox, so queue what fits and the rest on later frames as
+						// the inbox drains after each editor tick
+						if (!Batch->QueueLinks())
+						{
+							FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([Batch](float)
+							{
+								return !Batch->QueueLinks();
+							}));
+						}
+					});
+				});
+		}
+	});
+
+	// The game thread stops running tasks while the editor shuts down, so give up waiting once the server stops
+	bool bReady{ false };
+	while (!bReady && !bStopping.load(std::memory_order_relaxed))
+	{
+		bReady = Future.WaitFor(FTimespan::FromSeconds(BatchPollSeconds));
+	}
+	return bReady ? Future.Get() : TArray<uint8>{};
+}
+
+#if PLATFORM_WINDOWS
+bool FHyperlinkIpcServer::Listen()
+{
+	static constexpr DWORD BufferSize{ 64 * 1024 };
+
+	Platform->IoEvent = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+	Platform->StopEvent = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+	// A single instance which only accepts local clients, creating it fails if another editor for this project owns it
+	Platform->Pipe = CreateNamedPipeW(*EndpointName,
+		PIPE_ACCESS_DUPLEX | FILE_FLAG_OVERLAPPED | FILE_FLAG_FIRST_PIPE_INSTANCE,
+		PIPE_TYPE_BYTE | PIPE_READMODE_BYTE | PIPE_WAIT | PIPE_REJECT_REMOTE_CLIENTS,
+		1, BufferSize, BufferSize, 0, nullptr);
+
+	const bool bResult{ Platform->IoEvent && Platform->StopEvent && Platform->Pipe != INVALID_HANDLE_VALUE };
+	UE_CLOG(!bResult, LogHyperlinkEditor, Error, TEXT("Hyperlink IPC server couldn't create pipe %s (error %u), it "
+		"may be owned by another editor"), *EndpointName, GetLastError());
+	return bResult;
+}
+
+bool FHyperlinkIpcServer::Accept()
+{
+	OVERLAPPED Overlapped{ Platform->MakeOverlapped() };
+	const bool bCompleted{ ConnectNamedPipe(Platform->Pipe, &Overlapped) != FALSE };
+	DWORD NumBytes{ 0 };
+	// The client may have connected between creating or disconnecting the pipe and this call
+	return (!bCompleted && GetLastError() == ERROR_PIPE_CONNECTED)
+		|| Platform->Wait(Overlapped, bCompleted, NumBytes);
+}
+
+bool FHyperlinkIpcServer::Read(void* const Dest, const int32 NumBytes)
+{
+	uint8* Bytes{ static_cast<uint8*>(Dest) };
+	int32 NumRemaining{ NumBytes };
+	bool bResult{ true };
+	while (bResult && NumRemaining > 0)
+	{
+		OVERLAPPED Overlapped{ Platform->MakeOverlapped() };
+		const bool bCompleted{ ReadFile(Platform->Pipe, Bytes, NumRemaining, nullptr, &Overlapped) != FALSE };
+		DWORD NumRead{ 0 };
+		bResult = Platform->Wait(Overlapped, bCompleted, NumRead) && NumRead > 0;
+		Bytes += NumRead;
+		NumRemaining -= NumRead;
+	}
+	return bResult;
+}
+
+bool FHyperlinkIpcServer::Write(const void* const Src, const int32 NumBytes)
+{
+	const uint8* Bytes{ static_cast<const uint8*>(Src) };
+	int32 NumRemaining{ NumBytes };
+	bool bResult{ true };
+	while (bResult && NumRemaining > 0)
+	{
+		OVERLAPPED Overlapped{ Platform->MakeOverlapped() };
+		const bool bCompleted{ WriteFile(Platform->Pipe, Bytes, NumRemaining, nullptr, &Overlapped) != FALSE };
+		DWORD NumWritten{ 0 };
+		bResult = Platform->Wait(Overlapped, bCompleted, NumWritten) && NumWritten > 0;
+		Bytes += NumWritten;
+		NumRemaining -= NumWritten;
+	}
+	return bResult;
+}
+
+void FHyperlinkIpcServer::Disconnect()
+{
+	// Only called once the client has read every reply, disconnecting discards anything still in the pipe
+	DisconnectNamedPipe(Platform->Pipe);
+}
+
+void FHyperlinkIpcServer::Close()
+{
+	for (HANDLE* const Handle : { &Platform->IoEvent, &Platform->StopEvent })
+	{
+		if (*Handle)
+		{
+			CloseHandle(*Handle);
+			*Handle = nullptr;
+		}
+	}
+	if (Platform->Pipe != INVALID_HANDLE_VALUE)
+	{
+		CloseHandle(Platform->Pipe);
+		Platform->Pipe = INVALID_HANDLE_VALUE;
+	}
+}
+#elif PLATFORM_UNIX || PLATFORM_MAC
+bool FHyperlinkIpcServer::Listen()
+{
+	sockaddr_un Address{};
+	Address.sun_family = AF_UNIX;
+	const FTCHARToUTF8 Path{ *EndpointName };
+	bool bResult{ Path.Length() < static_cast<int32>(sizeof(Address.sun_path)) };
+	if (bResult)
+	{
+		FMemory::Memcpy(Address.sun_path, Path.Get(), Path.Length());
+		IFileManager::Get().MakeDirectory(*FPaths::GetPath(EndpointName), true);
+
+		// A socket left behind by an editor which crashed is replaced, one which accepts connections belongs to
+		// another editor for this project
+		const int Probe{ socket(AF_UNIX, SOCK_STREAM, 0) };
+		const bool bOwned{ Probe >= 0
+			&& connect(Probe, reinterpret_cast<const sockaddr*>(&Address), sizeof(Address)) == 0 };
+		if (Probe >= 0)
+		{
+			close(Probe);
+		}
+
+		if (!bOwned)
+		{
+			unlink(Path.Get());
+			Platform->ListenSocket = socket(AF_UNIX, SOCK_STREAM, 0);
+			bResult = Platform->ListenSocket >= 0
+				&& bind(Platform->ListenSocket, reinterpret_cast<const sockaddr*>(&Address), sizeof(Address)) == 0
+				&& listen(Platform->ListenSocket, SOMAXCONN) == 0
+				&& pipe(Platform->StopPipe) == 0;
+		}
+		else
+		{
+			bResult = false;
+		}
+	}
+
+	UE_CLOG(!bResult, LogHyperlinkEditor, Error, TEXT("Hyperlink IPC server couldn't listen on %s, the path may be too "
+		"long or owned by another editor"), *EndpointName);
+	return bResult;
+}
+
+bool FHyperlinkIpcServer::Accept()
+{
+	bool bResult{ false };
+	while (!bResult && Platform->Wait(Platform->ListenSocket, POLLIN))
+	{
+		Platform->ClientSocket = accept(Platform->ListenSocket, nullptr, nullptr);
+		// Non-blocking so a client which stops reading or writing can't keep the thread from stopping
+		bResult = Platform->ClientSocket >= 0
+			&& fcntl(Platform->ClientSocket, F_SETFL, fcntl(Platform->ClientSocket, F_GETFL) | O_NONBLOCK) == 0;
+		if (!bResult)
+		{
+			Disconnect();
+		}
+	}
+#if PLATFORM_MAC
+	if (bResult)
+	{
+		const int NoSigPipe{ 1 };
+		setsockopt(Platform->ClientSocket, SOL_SOCKET, SO_NOSIGPIPE, &NoSigPipe, sizeof(NoSigPipe));
+	}
+#endif //PLATFORM_MAC
+	return bResult;
+}
+
+bool FHyperlinkIpcServer::Read(void* const Dest, const int32 NumBytes)
+{
+	uint8* Bytes{ static_cast<uint8*>(Dest) };
+	int32 NumRemaining{ NumBytes };
+	bool bResult{ true };
+	while (bResult && NumRemaining > 0)
+	{
+		const ssize_t NumRead{ recv(Platform->ClientSocket, Bytes, NumRemaining, 0) };
+		if (NumRead > 0)
+		{
+			Bytes += NumRead;
+			NumRemaining -= NumRead;
+		}
+		else if (NumRead < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR))
+		{
+			bResult = Platform->Wait(Platform->ClientSocket, POLLIN);
+		}
+		else
+		{
+			// 0 when the client has disconnected
+			bResult = false;
+		}
+	}
+	return bResult;
+}
+
+bool FHyperlinkIpcServer::Write(const void* const Src, const int32 NumBytes)
+{
+#ifdef MSG_NOSIGNAL
+	static constexpr int Flags{ MSG_NOSIGNAL };
+#else
+	static constexpr int Flags{ 0 };
+#endif
+	const uint8* Bytes{ static_cast<const uint8*>(Src) };
+	int32 NumRemaining{ NumBytes };
+	bool bResult{ true };
+	while (bResult && NumRemaining > 0)
+	{
+		const ssize_t NumWritten{ send(Platform->ClientSocket, Bytes, NumRemaining, Flags) };
+		if (NumWritten > 0)
+		{
+			Bytes += NumWritten;
+			NumRemaining -= NumWritten;
+		}
+		else if (NumWritten < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR))
+		{
+			bResult = Platform->Wait(Platform->ClientSocket, POLLOUT);
+		}
+		else
+		{
+			bResult = false;
+		}
+	}
+	return bResult;
+}
+
+void FHyperlinkIpcServer::Disconnect()
+{
+	if (Platform->ClientSocket >= 0)
+	{
+		close(Platform->ClientSocket);
+		Platform->ClientSocket = -1;
+	}
+}
+
+void FHyperlinkIpcServer::Close()
+{
+	Disconnect();
+	if (Platform->ListenSocket >= 0)
+	{
+		close(Platform->ListenSocket);
+		Platform->ListenSocket = -1;
+		unlink(TCHAR_TO_UTF8(*EndpointName));
+	}
+	for (int& Descriptor : Platform->StopPipe)
+	{
+		if (Descriptor >= 0)
+		{
+			close(Descriptor);
+			Descriptor = -1;
+		}
+	}
+}
+#else
+bool FHyperlinkIpcServer::Listen()
+{
+	UE_LOG(LogHyperlinkEditor, Warning, TEXT("Hyperlink IPC server isn't supported on this platform"));
+	return false;
+}
+
+bool FHyperlinkIpcServer::Accept()
+{
+	return false;
+}
+
+bool FHyperlinkIpcServer::Read(void* const Dest, const int32 NumBytes)
+{
+	return false;
+}
+
+bool FHyperlinkIpcServer::Write(const void* const Src, const int32 NumBytes)
+{
+	return false;
+}
+
+void FHyperlinkIpcServer::Disconnect()
+{
+}
+
+void FHyperlinkIpcServer::Close()
+{
+}
+#endif //PLATFORM_WINDOWS
@@ -0,0 +1,79 @@
+﻿// Copyright (c) 2023-2024 Fergus Brown. Licensed under the MIT license. See "LICENSE" file for details.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+
+#include <atomic>
+
+/* Reply to each link of a batch. Part of the wire protocol, so values must never change */
+enum class EHyperlinkIpcStatus : uint8
+{
+	/* The link was queued to be executed */
+	Queued = 0,
+	Malformed = 1,
+	NotStored = 2,
+	UnknownDefinition = 3,
+	MissingAsset = 4,
+	/* Too many links were waiting and this one was dropped */
+	Dropped = 5,
+	/* The Hyperlink subsystem isn't available */
+	Unavailable = 6,
+	/* Identical to a link queued moments ago, which it was merged with */
+	Coalesced = 7,
+};
+
+/**
+ * Local transport for tools which send many links, e.g. pipeline scripts, IDE plugins and test runners, without HTTP
+ * parsing or contending for the server port. Listens on a Unix domain socket in Saved/Hyperlink, or a named pipe on
+ * Windows, on a thread of its own and serves one client at a time.
+ *
+ * Each link is sent as a frame: its length in bytes as a little endian uint32 then the link as UTF-8. A zero length
+ * frame ends a batch. The links are then decoded and queued in the same way as links received over HTTP, and one
+ * EHyperlinkIpcStatus byte is written back per link. A client can send any number of batches before disconnecting
+ */
+class FHyperlinkIpcServer final : public FRunnable
+{
+public:
+	FHyperlinkIpcServer();
+	virtual ~FHyperlinkIpcServer() override;
+
+	/**
+	 * @brief Create the endpoint and start listening, call on the game thread
+	 * @return false if the endpoint couldn't be created, e.g. another editor for this project owns it
+	 */
+	bool Start();
+
+	/* @return the socket path or pipe name clients connect to */
+	static FString GetEndpointName();
+
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+
+private:
+	/* Handles of the platform's transport, defined alongside its implementation */
+	struct FPlatformState;
+
+	bool Listen();
+	/* Block until a client connects. @return false if stopping */
+	bool Accept();
+	/* Block until every byte has been transferred. @return false if the client disconnected or stopping */
+	bool Read(void* Dest, int32 NumBytes);
+	bool Write(const void* Src, int32 NumBytes);
+	void Disconnect();
+	void Close();
+
+	void ServeClient();
+	/**
+	 * @brief Decode and queue a batch of links, blocking until the game thread has queued them. Links which don't fit
+	 * in the inbox wait for it to drain instead of being dropped
+	 * @return status of each link, empty if stopping
+	 */
+	TArray<uint8> ExecuteBatch(TArray<FString> Links) const;
+
+	FString EndpointName{};
+	TUniquePtr<FPlatformState> Platform;
+	FRunnableThread* Thread{ nullptr };
+	std::atomic<bool> bStopping{ false };
+};
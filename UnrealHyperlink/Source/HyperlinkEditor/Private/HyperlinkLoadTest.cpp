@@ -0,0 +1,353 @@
+﻿// Copyright (c) 2023-2024 Fergus Brown. Licensed under the MIT license. See "LICENSE" file for details.
+
+
+#include "HyperlinkLoadTest.h"
+
+#include "Async/Async.h"
+#include "Definitions/HyperlinkViewport.h"
+#include "Engine/Engine.h"
+#include "HyperlinkExecutePayload.h"
+#include "HyperlinkPayloadCodec.h"
+#include "HyperlinkSettings.h"
+#include "HyperlinkSubsystem.h"
+#include "HyperlinkUtility.h"
+#include "LogHyperlinkEditor.h"
+#include "SocketSubsystem.h"
+#include "Sockets.h"
+
+namespace FHyperlinkLoadTestState
+{
+	static constexpr double BaselineSeconds{ 2.0 };
+	/* How long to wait after the last response for the links still queued to be dispatched */
+	static constexpr double DrainTimeoutSeconds{ 5.0 };
+	static constexpr double RequestTimeoutSeconds{ 5.0 };
+
+	static TSharedPtr<FHyperlinkLoadTest, ESPMode::ThreadSafe>& GetRunning()
+	{
+		static TSharedPtr<FHyperlinkLoadTest, ESPMode::ThreadSafe> Running{ nullptr };
+		return Running;
+	}
+
+	/* Nearest rank percentile, sorts the samples */
+	static double GetPercentile(TArray<double>& Samples, const double Percentile)
+	{
+		double Ret{ 0.0 };
+		if (Samples.Num() > 0)
+		{
+			Samples.Sort();
+			Ret = Samples[FMath::Clamp(FMath::CeilToInt(Percentile * Samples.Num()) - 1, 0, Samples.Num() - 1)];
+		}
+		return Ret;
+	}
+
+	static double GetMean(const TArray<double>& Samples)
+	{
+		double Sum{ 0.0 };
+		for (const double Sample : Samples)
+		{
+			Sum += Sample;
+		}
+		return Samples.Num() > 0 ? Sum / Samples.Num() : 0.0;
+	}
+}
+
+/*static*/bool FHyperlinkLoadTest::Start(const FSettings& InSettings)
+{
+	using namespace FHyperlinkLoadTestState;
+	
+	bool bResult{ false };
+	
+	UHyperlinkSubsystem* const HyperlinkSubsystem{ GEngine->GetEngineSubsystem<UHyperlinkSubsystem>() };
+	if (GetRunning().IsValid())
+	{
+		UE_LOG(LogHyperlinkEditor, Warning, TEXT("A load test is already running"));
+	}
+	else if (HyperlinkSubsystem == nullptr)
+	{
+		UE_LOG(LogHyperlinkEditor, Error, TEXT("Cannot run load test: UHyperlinkSubsystem not yet initialised."));
+	}
+	else if (HyperlinkSubsystem->FindIdentifier(UHyperlinkViewport::StaticClass()).IsEmpty())
+	{
+		UE_LOG(LogHyperlinkEditor, Error, TEXT("Cannot run load test: it sends %s links, which must be registered"),
+			*UHyperlinkViewport::StaticClass()->GetName());
+	}
+	else
+	{
+		const TSharedRef<FHyperlinkLoadTest, ESPMode::ThreadSafe> LoadTest
+			{ MakeShared<FHyperlinkLoadTest, ESPMode::ThreadSafe>(InSettings) };
+		if (LoadTest->CreateLinks())
+		{
+			// Links sent by the load test must not open anything
+			HyperlinkSubsystem->SetDryRun(true);
+			LoadTest->DispatchedHandle = HyperlinkSubsystem->OnLinkDispatched().AddSP(LoadTest,
+				&FHyperlinkLoadTest::OnLinkDispatched);
+			LoadTest->TickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+				FTickerDelegate::CreateSP(LoadTest, &FHyperlinkLoadTest::Tick));
+			LoadTest->PhaseStartTime = FPlatformTime::Seconds();
+			GetRunning() = LoadTest;
+			
+			UE_LOG(LogHyperlinkEditor, Display, TEXT("Load test: measuring frame time for %.0fs, then sending %d links "
+				"at %.0f/s to port %d with up to %d in flight. Links will not execute until it finishes"),
+				BaselineSeconds, LoadTest->LinkPaths.Num(), InSettings.RequestsPerSecond, LoadTest->Port,
+				InSettings.Concurrency);
+			bResult = true;
+		}
+	}
+	
+	return bResult;
+}
+
+FHyperlinkLoadTest::FHyperlinkLoadTest(const FSettings& InSettings)
+	: Settings{ InSettings }
+	, Port{ static_cast<int32>(GetDefault<UHyperlinkSettings>()->GetLocalServerPort()) }
+{
+}
+
+bool FHyperlinkLoadTest::CreateLinks()
+{
+	const int32 NumRequests{ FMath::Max(FMath::CeilToInt(Settings.RequestsPerSecond * Settings.DurationSeconds), 1) };
+	
+	// Every link moves the camera to a different location so none are coalesced, and the index of the request can
+	// be read back when the link is dispatched. The package exists in every project so links pass the asset check
+	TArray<FString> PayloadStrings{};
+	PayloadStrings.Reserve(NumRequests);
+	for (int32 Idx{ 0 }; Idx < NumRequests; ++Idx)
+	{
+		const FHyperlinkViewportPayload Payload{ TEXT("/Engine/BasicShapes/Cube"), FVector(Idx, 0.0, 0.0),
+			FRotator::ZeroRotator };
+		FHyperlinkPayloadCodec::WriteStruct(FHyperlinkViewportPayload::StaticStruct(), &Payload,
+			PayloadStrings.Emplace_GetRef());
+	}
+	
+	// Links always point at localhost, only the path is needed to request them over loopback
+	const FString Origin{ FString::Printf(TEXT("http://localhost:%d"), Port) };
+	LinkPaths = FHyperlinkUtility::CreateLinksFromPayloads(UHyperlinkViewport::StaticClass(), PayloadStrings);
+	bool bResult{ LinkPaths.Num() == NumRequests };
+	for (FString& LinkPath : LinkPaths)
+	{
+		bResult &= LinkPath.StartsWith(Origin);
+		LinkPath.RightChopInline(Origin.Len());
+	}
+	UE_CLOG(!bResult, LogHyperlinkEditor, Error, TEXT("Cannot run load test: could not create links to %s"), *Origin);
+
+	Requests.SetNum(NumRequests);
+	DispatchTimes.Init(0.0, NumRequests);
+	return bResult;
+}
+
+void FHyperlinkLoadTest::StartWorkers()
+{
+	LoadStartTime = FPlatformTime::Seconds();
+	const int32 NumWorkers{ FMath::Clamp(Settings.Concurrency, 1, LinkPaths.Num()) };
+	NumRunningWorkers.store(NumWorkers, std::memory_order_relaxed);
+	for (int32 Idx{ 0 }; Idx < NumWorkers; ++Idx)
+	{
+		// Workers block on their sockets so need their own threads rather than the task graph
+		Async(EAsyncExecution::Thread, [This = AsShared()]()
+		{
+			This->RunWorker();
+		});
+	}
+}
+
+void FHyperlinkLoadTest::RunWorker()
+{
+	for (int32 Idx{ NextRequest.fetch_add(1, std::memory_order_relaxed) }; Idx < LinkPaths.Num();
+		Idx = NextRequest.fetch_add(1, std::memory_order_relaxed))
+	{
+		// Requests are sent on a fixed schedule, requests which are late because every worker was busy are sent
+		// immediately
+		const double WaitSeconds{ LoadStartTime + Idx / Settings.RequestsPerSecond - FPlatformTime::Seconds() };
+		if (WaitSeconds > 0.0)
+		{
+			FPlatformProcess::Sleep(static_cast<float>(WaitSeconds));
+		}
+		
+		FRequest& Request{ Requests[Idx] };
+		Request.SendTime = FPlatformTime::Seconds();
+		Request.StatusCode = SendRequest(LinkPaths[Idx]);
+		Request.ResponseTime = FPlatformTime::Seconds();
+	}
+	
+	// Publishes this worker's requests to the game thread
+	NumRunningWorkers.fetch_sub(1, std::memory_order_release);
+}
+
+int32 FHyperlinkLoadTest::SendRequest(const FString& Path) const
+{
+	int32 StatusCode{ 0 };
+	
+	ISocketSubsystem* const SocketSubsystem{ ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM) };
+	FSocket* const Socket{ SocketSubsystem->CreateSocket(NAME_Stream, TEXT("HyperlinkLoadTest"), false) };
+	const TSharedRef<FInternetAddr> Address{ SocketSubsystem->CreateInternetAddr() };
+	Address->SetLoopbackAddress();
+	Address->SetPort(Port);
+	
+	if (Socket && Socket->Connect(*Address))
+	{
+		// Not accepting HTML makes the server respond once the link is queued, with 503 if it was dropped
+		const FTCHARToUTF8 Request{ *FString::Printf(
+			TEXT("GET %s HTTP/1.1\r\nHost: localhost:%d\r\nAccept: */*\r\nConnection: close\r\n\r\n"), *Path,
+			Port) };
+		int32 BytesSent{ 0 };
+		if (Socket->Send(reinterpret_cast<const uint8*>(Request.Get()), Request.Length(), BytesSent))
+		{
+			// The round trip ends at the status line, e.g. "HTTP/1.1 200 OK", the rest of the response isn't needed
+			TArray<uint8, TInlineAllocator<256>> Response{};
+			uint8 Buffer[256];
+			int32 BytesRead{ 0 };
+			while (!Response.Contains('\n')
+				&& Socket->Wait(ESocketWaitConditions::WaitForRead,
+					FTimespan::FromSeconds(FHyperlinkLoadTestState::RequestTimeoutSeconds))
+				&& Socket->Recv(Buffer, sizeof(Buffer), BytesRead) && BytesRead > 0)
+			{
+				Response.Append(Buffer, BytesRead);
+			}
+			
+			const FUTF8ToTCHAR StatusLine{ reinterpret_cast<const ANSICHAR*>(Response.GetData()), Response.Num() };
+			TArray<FString> StatusParts{};
+			FString(StatusLine.Length(), StatusLine.Get()).ParseIntoArrayWS(StatusParts);
+			if (StatusParts.Num() >= 2)
+			{
+				LexFromString(StatusCode, *StatusParts[1]);
+			}
+		}
+	}
+	
+	if (Socket)
+	{
+		Socket->Close();
+		SocketSubsystem->DestroySocket(Socket);
+	}
+	return StatusCode;
+}
+
+bool FHyperlinkLoadTest::Tick(const float DeltaTime)
+{
+	using namespace FHyperlinkLoadTestState;
+	
+	bool bContinue{ true };
+	const double Now{ FPlatformTime::Seconds() };
+	switch (Phase)
+	{
+	case EPhase::Baseline:
+		BaselineFrameTimes.Add(DeltaTime);
+		if (Now - PhaseStartTime >= BaselineSeconds)
+		{
+			Phase = EPhase::Load;
+			PhaseStartTime = Now;
+			StartWorkers();
+		}
+		break;
+	case EPhase::Load:
+		LoadFrameTimes.Add(DeltaTime);
+		if (NumRunningWorkers.load(std::memory_order_acquire) == 0)
+		{
+			Phase = EPhase::Drain;
+			PhaseStartTime = Now;
+		}
+		break;
+	case EPhase::Drain:
+		{
+			int32 NumQueued{ 0 };
+			int32 NumDispatched{ 0 };
+			for (int32 Idx{ 0 }; Idx < Requests.Num(); ++Idx)
+			{
+				NumQueued += Requests[Idx].StatusCode == 200 ? 1 : 0;
+				NumDispatched += DispatchTimes[Idx] > 0.0 ? 1 : 0;
+			}
+			if (NumDispatched >= NumQueued || Now - PhaseStartTime >= DrainTimeoutSeconds)
+			{
+				Finish();
+				bContinue = false;
+			}
+		}
+		break;
+	default:
+		checkNoEntry();
+		break;
+	}
+	return bContinue;
+}
+
+void FHyperlinkLoadTest::OnLinkDispatched(const FHyperlinkExecutePayload& Payload)
+{
+	FHyperlinkViewportPayload ViewportPayload{};
+	if (FHyperlinkPayloadCodec::ReadStruct(Payload.DefinitionPayload.JsonString,
+		FHyperlinkViewportPayload::StaticStruct(), &ViewportPayload))
+	{
+		const int32 Idx{ FMath::RoundToInt(ViewportPayload.Location.X) };
+		if (DispatchTimes.IsValidIndex(Idx) && DispatchTimes[Idx] == 0.0)
+		{
+			DispatchTimes[Idx] = FPlatformTime::Seconds();
+		}
+	}
+}
+
+void FHyperlinkLoadTest::Finish()
+{
+	if (UHyperlinkSubsystem* const HyperlinkSubsystem{ GEngine->GetEngineSubsystem<UHyperlinkSubsystem>() })
+	{
+		HyperlinkSubsystem->OnLinkDispatched().Remove(DispatchedHandle);
+		HyperlinkSubsystem->SetDryRun(false);
+	}
+	DispatchedHandle.Reset();
+	TickerHandle.Reset();
+
+	Report();
+	FHyperlinkLoadTestState::GetRunning().Reset();
+}
+
+void FHyperlinkLoadTest::Report() const
+{
+	using namespace FHyperlinkLoadTestState;
+	
+	TMap<int32, int32> NumStatusCodes{};
+	TArray<double> RoundTripTimes{};
+	TArray<double> DispatchDelays{};
+	double LastResponseTime{ LoadStartTime };
+	for (int32 Idx{ 0 }; Idx < Requests.Num(); ++Idx)
+	{
+		const FRequest& Request{ Requests[Idx] };
+		++NumStatusCodes.FindOrAdd(Request.StatusCode);
+		if (Request.StatusCode != 0)
+		{
+			RoundTripTimes.Add(Request.ResponseTime - Request.SendTime);
+			LastResponseTime = FMath::Max(LastResponseTime, Request.ResponseTime);
+		}
+		// Negative if the link was dispatched before the response reached the worker
+		if (DispatchTimes[Idx] > 0.0)
+		{
+			DispatchDelays.Add(DispatchTimes[Idx] - Request.ResponseTime);
+		}
+	}
+	
+	FString StatusCodes{};
+	NumStatusCodes.KeySort(TLess<int32>());
+	for (const TPair<int32, int32>& Pair : NumStatusCodes)
+	{
+		StatusCodes.Appendf(TEXT("%s%s: %d"), StatusCodes.IsEmpty() ? TEXT("") : TEXT(", "),
+			Pair.Key == 0 ? TEXT("failed") : *LexToString(Pair.Key), Pair.Value);
+	}
+	
+	const int32 NumCompleted{ RoundTripTimes.Num() };
+	const double LoadSeconds{ LastResponseTime - LoadStartTime };
+	TArray<double> BaselineSamples{ BaselineFrameTimes };
+	TArray<double> LoadSamples{ LoadFrameTimes };
+	
+	UE_LOG(LogHyperlinkEditor, Display, TEXT("Load test: %d requests at %.0f/s with up to %d in flight\n"
+		"  Responses: %s\n"
+		"  Throughput: %.1f requests/s\n"
+		"  Round trip: p50 %.2fms, p99 %.2fms, max %.2fms\n"
+		"  Response to dispatch: p50 %.2fms, p99 %.2fms (%d of %d links dispatched)\n"
+		"  Frame time: %.2fms mean, %.2fms p99 without load; %.2fms mean, %.2fms p99 under load"),
+		Requests.Num(), Settings.RequestsPerSecond, Settings.Concurrency,
+		*StatusCodes,
+		LoadSeconds > 0.0 ? NumCompleted / LoadSeconds : 0.0,
+		GetPercentile(RoundTripTimes, 0.5) * 1000.0, GetPercentile(RoundTripTimes, 0.99) * 1000.0,
+		GetPercentile(RoundTripTimes, 1.0) * 1000.0,
+		GetPercentile(DispatchDelays, 0.5) * 1000.0, GetPercentile(DispatchDelays, 0.99) * 1000.0,
+		DispatchDelays.Num(), NumStatusCodes.FindRef(200),
+		GetMean(BaselineFrameTimes) * 1000.0, GetPercentile(BaselineSamples, 0.99) * 1000.0,
+		GetMean(LoadFrameTimes) * 1000.0, GetPercentile(LoadSamples, 0.99) * 1000.0);
+}
@@ -0,0 +1,90 @@
+﻿// Copyright (c) 2023-2024 Fergus Brown. Licensed under the MIT license. See "LICENSE" file for details.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+
+#include <atomic>
+
+struct FHyperlinkExecutePayload;
+
+/**
+ * Fires links at the local link server over loopback to measure how it behaves under load, run by the uhl.LoadTest
+ * console command. Requests are sent from worker threads at a fixed rate while the game thread keeps ticking, and the
+ * subsystem runs dry so the links are dispatched without opening anything. Reports throughput, round trip latency,
+ * the delay from the response to the link being dispatched and the frame time with and without load
+ */
+class FHyperlinkLoadTest : public TSharedFromThis<FHyperlinkLoadTest, ESPMode::ThreadSafe>
+{
+public:
+	struct FSettings
+	{
+		double RequestsPerSecond{ 100.0 };
+		/* Maximum number of requests in flight */
+		int32 Concurrency{ 4 };
+		double DurationSeconds{ 10.0 };
+	};
+
+	/**
+	 * @brief Start a load test, the results are logged when it finishes
+	 * @return false if a load test is already running or the links couldn't be created
+	 */
+	static bool Start(const FSettings& InSettings);
+
+	explicit FHyperlinkLoadTest(const FSettings& InSettings);
+
+private:
+	enum class EPhase : uint8
+	{
+		/* Measuring frame time without load */
+		Baseline,
+		/* Workers are sending requests */
+		Load,
+		/* Waiting for the last links to be dispatched */
+		Drain,
+	};
+
+	struct FRequest
+	{
+		double SendTime{ 0.0 };
+		double ResponseTime{ 0.0 };
+		/* 0 if the request failed */
+		int32 StatusCode{ 0 };
+	};
+
+	bool CreateLinks();
+	void StartWorkers();
+	void RunWorker();
+
+	/* Send a GET request to the loopback address and read the status line of the response, blocking */
+	int32 SendRequest(const FString& Path) const;
+
+	bool Tick(float DeltaTime);
+	void OnLinkDispatched(const FHyperlinkExecutePayload& Payload);
+	void Finish();
+	void Report() const;
+
+	const FSettings Settings;
+	int32 Port{ 0 };
+
+	/* Path of each link to request, each link is unique so none are coalesced */
+	TArray<FString> LinkPaths{};
+	/* Written by the worker which sent the request, read once every worker has finished */
+	TArray<FRequest> Requests{};
+	/* Game thread only */
+	TArray<double> DispatchTimes{};
+
+	std::atomic<int32> NextRequest{ 0 };
+	std::atomic<int32> NumRunningWorkers{ 0 };
+
+	EPhase Phase{ EPhase::Baseline };
+	double PhaseStartTime{ 0.0 };
+	double LoadStartTime{ 0.0 };
+	double LoadEndTime{ 0.0 };
+	TArray<double> BaselineFrameTimes{};
+	TArray<double> LoadFrameTimes{};
+
+	FTSTicker::FDelegateHandle TickerHandle{};
+	FDelegateHandle DispatchedHandle{};
+};
@@ -0,0 +1,72 @@
+﻿// Copyright (c) 2023-2024 Fergus Brown. Licensed under the MIT license. See "LICENSE" file for details.
+
+
+#include "Algo/Find.h"
+#include "HyperlinkBenchmark.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace FHyperlinkBenchmarkTestConstants
+{
+	static constexpr int32 Iterations{ 1000 };
+	
+	/* Budgets are generous so the test only fails on regressions, not on slow or busy machines */
+	struct FThreshold
+	{
+		/* Matches every case whose name starts with this */
+		const TCHAR* NamePrefix;
+		double MaxMedianMicroseconds;
+		/* Negative for no limit */
+		double MaxAllocationsPerIteration;
+	};
+	
+	static const FThreshold Thresholds[]
+	{
+		{ TEXT("EscapeUrlString/"), 5.0, -1.0 },
+		{ TEXT("ParseUrlString/"), 5.0, -1.0 },
+		{ TEXT("WriteStruct/"), 25.0, -1.0 },
+		{ TEXT("ReadStruct/"), 25.0, -1.0 },
+		{ TEXT("CreateLinkFromPayload/Cached/"), 10.0, -1.0 },
+		{ TEXT("CreateLinkFromPayload/Uncached/"), 100.0, -1.0 },
+		// Finding the payload and dispatching to a definition must not allocate
+		{ TEXT("TryFindPayloadString/"), 5.0, 0.0 },
+		{ TEXT("DecodeLink/"), 50.0, -1.0 },
+		{ TEXT("GetDefinition/"), 5.0, 0.0 },
+	};
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHyperlinkBenchmarkTest, "Hyperlink.Benchmark",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FHyperlinkBenchmarkTest::RunTest(const FString& Parameters)
+{
+	using namespace FHyperlinkBenchmarkTestConstants;
+	
+	TArray<FHyperlinkBenchmark::FResult> Results{};
+	TestTrue(TEXT("Every benchmark case succeeded and the report was written"),
+		FHyperlinkBenchmark::Run(Iterations, Results));
+	TestTrue(TEXT("Benchmark ran cases"), Results.Num() > 0);
+	
+	for (const FHyperlinkBenchmark::FResult& Result : Results)
+	{
+		const FThreshold* const Threshold{ Algo::FindByPredicate(Thresholds, [&Result](const FThreshold& Candidate)
+			{ return Result.Name.StartsWith(Candidate.NamePrefix, ESearchCase::CaseSensitive); }) };
+		if (TestNotNull(FString::Printf(TEXT("%s has a threshold"), *Result.Name), Threshold))
+		{
+			TestTrue(FString::Printf(TEXT("%s median %.3fus is within %.3fus"), *Result.Name,
+				Result.MedianSeconds * 1.0e6, Threshold->MaxMedianMicroseconds),
+				Result.MedianSeconds * 1.0e6 <= Threshold->MaxMedianMicroseconds);
+			if (Threshold->MaxAllocationsPerIteration >= 0.0)
+			{
+				TestTrue(FString::Printf(TEXT("%s makes %.1f allocations per iteration, at most %.1f"), *Result.Name,
+					Result.AllocationsPerIteration, Threshold->MaxAllocationsPerIteration),
+					Result.AllocationsPerIteration <= Threshold->MaxAllocationsPerIteration);
+			}
+		}
+	}
+	
+	return !HasAnyErrors();
+}
+
+#endif //WITH_DEV_AUTOMATION_TESTS
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "HyperlinkDefinition.h"
+#include "HyperlinkTypedDefinition.h"
 #include "HyperlinkLevelActor.generated.h"
 
 class FHyperlinkLevelActorCommands : public TCommands<FHyperlinkLevelActorCommands>
@@ -14,6 +15,7 @@ public:
 
 public:
 	TSharedPtr<FUICommandInfo> CopyLevelActorLink{ nullptr };
+	TSharedPtr<FUICommandInfo> CopyLevelActorLinks{ nullptr };
 };
 
 USTRUCT()
@@ -32,17 +34,22 @@ struct FHyperlinkLevelActorPayload
  * Hyperlink for opening a level and focusing on an actor in the level
  */
 UCLASS()
-class HYPERLINKEDITOR_API UHyperlinkLevelActor : public UHyperlinkDefinition
+class HYPERLINKEDITOR_API UHyperlinkLevelActor : public UHyperlinkDefinition,
+	public THyperlinkTypedDefinition<FHyperlinkLevelActorPayload>
 {
 	GENERATED_BODY()
+	HYPERLINK_TYPED_DEFINITION_BODY()
 	
 public:
 	virtual void Initialize() override;
 	virtual void Deinitialize() override;
+	virtual bool GetDeferredInitializeMenus(TArray<FName>& OutMenuNames) const override;
 	
-	virtual TSharedPtr<FJsonObject> GeneratePayload(const TArray<FString>& Args) const override;
+	virtual bool GenerateTypedPayload(const TArray<FString>& Args, FHyperlinkLevelActorPayload& OutPayload) const override;
+	virtual bool GenerateTypedPayloads(const TArray<FString>& Args, TArray<FHyperlinkLevelActorPayload>& OutPayloads) const override;
 	
-	virtual void ExecutePayload(const TSharedRef<FJsonObject>& InPayload) override;
+	virtual void ExecuteTypedPayload(const FHyperlinkLevelActorPayload& InPayload) override;
+	virtual void GetTypedPayloadDependencies(const FHyperlinkLevelActorPayload& InPayload, TArray<FName>& OutPackageNames) const override;
 	
 private:
 	TSharedPtr<FUICommandList> LevelActorCommands{};
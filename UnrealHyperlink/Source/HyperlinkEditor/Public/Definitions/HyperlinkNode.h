@@ -63,17 +63,21 @@ public:
 	virtual void Deinitialize() override;
 	
 	virtual TSharedPtr<FJsonObject> GeneratePayload(const TArray<FString>& Args) const override;
-	static TSharedPtr<FJsonObject> GenerateBlueprintPayload(const FName& AssetPackageName, const FGuid& GraphGuid,
-		const FGuid& NodeGuid);
-	static TSharedPtr<FJsonObject> GenerateMaterialPayload(const FName& AssetPackageName, const FGuid& NodeGuid,
-		int32 NodeX, int32 NodeY);
-	static TSharedPtr<FJsonObject> GenerateMaterialPayload(const UMaterial& InMaterial, const UEdGraphNode& InNode);
+	virtual bool GeneratePayloadString(const TArray<FString>& Args, FString& OutPayloadString) const override;
+	static bool TryMakeMaterialPayload(const UMaterial& InMaterial, const UEdGraphNode& InNode,
+		FHyperlinkMaterialPayload& OutPayload);
 	
 	virtual void ExecutePayload(const TSharedRef<FJsonObject>& InPayload) override;
+	virtual bool ExecutePayloadString(FStringView InPayloadString) override;
+	virtual void GetPayloadDependencies(FStringView InPayloadString, TArray<FName>& OutPackageNames) const override;
 	static void ExecuteBlueprintPayload(const FHyperlinkBlueprintPayload& InPayload);
 	static void ExecuteMaterialPayload(const FHyperlinkMaterialPayload& InPayload);
 	
 private:
+	/* Make the payload for the selected node and pass it to Visitor, which is called with either payload type */
+	template<typename TVisitor>
+	bool VisitSelectedNodePayload(TVisitor&& Visitor) const;
+	
 	static bool TryGetExtensionPoint(const UClass* Class, FName& OutExtensionPoint);
 
 private:
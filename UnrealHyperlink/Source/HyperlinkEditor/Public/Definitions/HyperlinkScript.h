@@ -27,8 +27,11 @@ class HYPERLINKEDITOR_API UHyperlinkScript : public UHyperlinkDefinition
 public:
 	virtual void Initialize() override;
 	virtual void Deinitialize() override;
+	virtual bool GetDeferredInitializeMenus(TArray<FName>& OutMenuNames) const override;
 	virtual TSharedPtr<FJsonObject> GeneratePayload(const TArray<FString>& Args) const override;
+	virtual bool GeneratePayloadStrings(const TArray<FString>& Args, TArray<FString>& OutPayloadStrings) const override;
 	virtual void ExecutePayload(const TSharedRef<FJsonObject>& InPayload) override;
+	virtual void GetPayloadDependencies(FStringView InPayloadString, TArray<FName>& OutPackageNames) const override;
 
 	/* Generate payload from the provided string, creating a relative path if possible */
 	static TSharedPtr<FJsonObject> GenerateScriptPayload(FString ScriptPath);
@@ -36,6 +39,7 @@ public:
 	/* Generate payload from selected blutility in content browser */
 	static TSharedPtr<FJsonObject> GeneratePayloadFromSelectedBlutility();
 private:
+	static TArray<FAssetData> GetSelectedBlutilities();
 	static bool IsBlutilitySelected();
 	static bool UserConfirmedScriptExecution(const FString& ScriptName);
 	
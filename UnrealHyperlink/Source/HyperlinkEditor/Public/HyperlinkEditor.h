@@ -5,10 +5,14 @@
 #include "CoreMinimal.h"
 #include "HttpResultCallback.h"
 #include "HttpRouteHandle.h"
+#include "HttpServerConstants.h"
 #include "Modules/ModuleManager.h"
 
+class FHyperlinkIpcServer;
 class IHttpRouter;
+enum class EHyperlinkDecodeResult : uint8;
 struct FHttpServerRequest;
+struct FHttpServerResponse;
 
 class FHyperlinkEditorCommands : public TCommands<FHyperlinkEditorCommands>
 {
@@ -34,16 +38,57 @@ private:
     void UnregisterPaste();
     static void PasteLink();
 
+    /*
+     * Log the length and encode/decode time of each link format for the built-in payload types, and compare the
+     * typed payload codec to FJsonObjectConverter
+     */
+    static void ReportLinkFormats();
+    /* Run the link pipeline benchmarks, optionally with a number of iterations */
+    static void BenchConsole(const TArray<FString>& Args);
+    /* Load test the link server, optionally with a request rate, concurrency and duration */
+    static void LoadTestConsole(const TArray<FString>& Args);
+
     void StartHttpServer();
     void ShutdownHttpServer();
     static bool HandleHttpRequest(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
+    /**
+     * @brief Error code and message for a link that failed to queue, left untouched if it succeeded
+     * @param bQueued Whether a successfully decoded link was accepted by the link inbox
+     * @return the status code to respond to clients which wait for the link with, Ok if it was queued
+     */
+    static EHttpServerResponseCodes GetLinkError(EHyperlinkDecodeResult DecodeResult, bool bQueued,
+        FString& OutErrorCode, FString& OutErrorMessage);
+    /* @return true if any value of the header contains Value */
+    static bool HasHeaderValue(const FHttpServerRequest& Request, const TCHAR* Header, const TCHAR* Value);
+    /* Build the page links respond with, plain and gzipped */
+    static void BuildLinkResponsePage();
+    /* The cached link page, gzipped if the browser accepts it */
+    static TUniquePtr<FHttpServerResponse> CreateLinkResponse(const FHttpServerRequest& Request);
+    /* State of the most recent link, polled by the link page */
+    static bool HandleStatusRequest(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
+    /* Counters and execute time histograms in the Prometheus text format, for scraping by local tooling */
+    static bool HandleMetricsRequest(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
+    /* Whether the definitions are initialized and the editor is idle. 503 until the definitions are initialized */
+    static bool HandleHealthRequest(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
+
+    /* Local socket or pipe for tools which send many links, see FHyperlinkIpcServer */
+    void StartIpcServer();
+    void ShutdownIpcServer();
 
-    static void ExecuteLinkFromString(const FString& InString);
+    static bool ExecuteLinkFromString(const FString& InString);
 
 private:
     FDelegateHandle HttpRouteHandle{};
     IConsoleObject* PasteConsoleCommand{ nullptr };
+    IConsoleObject* LinkFormatReportConsoleCommand{ nullptr };
+    IConsoleObject* BenchConsoleCommand{ nullptr };
+    IConsoleObject* LoadTestConsoleCommand{ nullptr };
     
     TSharedPtr<IHttpRouter> HttpRouter{ nullptr };
     FHttpRouteHandle HttpRequestHandle{};
+    FHttpRouteHandle MetricsRequestHandle{};
+    FHttpRouteHandle HealthRequestHandle{};
+    FHttpRouteHandle StatusRequestHandle{};
+
+    TUniquePtr<FHyperlinkIpcServer> IpcServer{ nullptr };
 };